@@ -3,6 +3,7 @@ set(ELLIPTIC_SOURCE_DIR ${CMAKE_CURRENT_SOURCE_DIR}/src/elliptic)
 set(ELLIPTIC_SOURCES
         ${ELLIPTIC_SOURCE_DIR}/linearSolver/PCG.cpp
         ${ELLIPTIC_SOURCE_DIR}/linearSolver/PGMRES.cpp
+        ${ELLIPTIC_SOURCE_DIR}/linearSolver/PipelinedPCG.cpp
         ${ELLIPTIC_SOURCE_DIR}/amgSolver/amgx/AMGX.cpp
         ${ELLIPTIC_SOURCE_DIR}/ellipticApplyMask.cpp
         ${ELLIPTIC_SOURCE_DIR}/ellipticUpdateJacobi.cpp
@@ -12,6 +13,7 @@ set(ELLIPTIC_SOURCES
         ${ELLIPTIC_SOURCE_DIR}/MG/ellipticMultiGridUpdateLambda.cpp
         ${ELLIPTIC_SOURCE_DIR}/MG/optimalCoeffs.cpp
         ${ELLIPTIC_SOURCE_DIR}/MG/determineMGLevels.cpp
+        ${ELLIPTIC_SOURCE_DIR}/MG/MGAutotuner.cpp
         ${ELLIPTIC_SOURCE_DIR}/MG/parseMultigridSchedule.cpp
         ${ELLIPTIC_SOURCE_DIR}/MG/ellipticMultiGridLevel.cpp
         ${ELLIPTIC_SOURCE_DIR}/MG/ellipticMultiGridLevelSetup.cpp
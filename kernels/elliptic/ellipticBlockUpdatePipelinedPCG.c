@@ -0,0 +1,80 @@
+/*
+
+   The MIT License (MIT)
+
+   Copyright (c) 2017 Tim Warburton, Noel Chalmers, Jesse Chan, Ali Karakus
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to deal
+   in the Software without restriction, including without limitation the rights
+   to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+   copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in all
+   copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+
+ */
+
+extern "C" void FUNC(ellipticBlockUpdatePipelinedPCG)(const dlong & Nblocks,
+                       const dlong & N,
+                       const dlong & offset,
+                       const dfloat* __restrict__ cpu_invDegree,
+                       const dfloat & alpha,
+                       const dfloat & beta,
+                       const dfloat* __restrict__ cpu_m,
+                       const dfloat* __restrict__ cpu_n,
+                       dfloat* __restrict__ cpu_z,
+                       dfloat* __restrict__ cpu_q,
+                       dfloat* __restrict__ cpu_s,
+                       dfloat* __restrict__ cpu_p,
+                       dfloat* __restrict__ cpu_x,
+                       dfloat* __restrict__ cpu_r,
+                       dfloat* __restrict__ cpu_u,
+                       dfloat* __restrict__ cpu_w,
+                       dfloat* __restrict__ cpu_reduction)
+{
+  dfloat ru = 0;
+  dfloat wu = 0;
+  dfloat rr = 0;
+
+  for(int fld = 0; fld < p_Nfields; fld++)
+    for(int id = 0; id < N; ++id) {
+      const dlong i = id + fld * offset;
+
+      const dfloat zi = cpu_n[i] + beta * cpu_z[i];
+      const dfloat qi = cpu_m[i] + beta * cpu_q[i];
+      const dfloat si = cpu_w[i] + beta * cpu_s[i];
+      const dfloat pi = cpu_u[i] + beta * cpu_p[i];
+
+      const dfloat ri = cpu_r[i] - alpha * si;
+      const dfloat ui = cpu_u[i] - alpha * qi;
+      const dfloat wi = cpu_w[i] - alpha * zi;
+
+      cpu_z[i] = zi;
+      cpu_q[i] = qi;
+      cpu_s[i] = si;
+      cpu_p[i] = pi;
+      cpu_x[i] += alpha * pi;
+      cpu_r[i] = ri;
+      cpu_u[i] = ui;
+      cpu_w[i] = wi;
+
+      const dfloat wgt = cpu_invDegree[id];
+      ru += wgt * ri * ui;
+      wu += wgt * wi * ui;
+      rr += wgt * ri * ri;
+    }
+
+  cpu_reduction[0 * Nblocks] = ru;
+  cpu_reduction[1 * Nblocks] = wu;
+  cpu_reduction[2 * Nblocks] = rr;
+}
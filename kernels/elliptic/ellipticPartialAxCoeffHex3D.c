@@ -96,3 +96,138 @@ extern "C" void FUNC(ellipticPartialAxCoeffHex3D_v0)(const dlong & Nelements,
   }
 }
 #endif
+
+// elements are batched across SIMD lanes (lane index innermost),
+// variant 1 targets 256-bit and variant 2 512-bit vector units
+#if p_knl == 1
+#define p_simdWidth (32 / sizeof(dfloat))
+#define SIMD_KERNEL_NAME ellipticPartialAxCoeffHex3D_v1
+#elif p_knl == 2
+#define p_simdWidth (64 / sizeof(dfloat))
+#define SIMD_KERNEL_NAME ellipticPartialAxCoeffHex3D_v2
+#endif
+
+#if p_knl == 1 || p_knl == 2
+extern "C" void FUNC(SIMD_KERNEL_NAME)(const dlong & Nelements,
+                        const dlong & offset,
+                        const dlong & loffset,
+                        const dlong* __restrict__ elementList,
+                        const dfloat* __restrict__ ggeo,
+                        const dfloat* __restrict__ D,
+                        const dfloat* __restrict__ S,
+                        const dfloat* __restrict__ lambda0,
+                        const dfloat* __restrict__ lambda1,
+                        const dfloat* __restrict__ q,
+                        dfloat* __restrict__ Aq )
+{
+  constexpr int W = p_simdWidth;
+
+  alignas(64) dfloat s_q[p_Nq][p_Nq][p_Nq][W];
+  alignas(64) dfloat s_Gqr[p_Nq][p_Nq][p_Nq][W];
+  alignas(64) dfloat s_Gqs[p_Nq][p_Nq][p_Nq][W];
+  alignas(64) dfloat s_Gqt[p_Nq][p_Nq][p_Nq][W];
+
+  const dlong Nbatches = (Nelements + W - 1) / W;
+
+#ifdef __NEKRS__OMP__
+  #pragma omp parallel for private(s_q, s_Gqr, s_Gqs, s_Gqt)
+#endif
+  for(dlong batch = 0; batch < Nbatches; ++batch) {
+    const dlong e0 = batch * W;
+    const int Nlanes = (Nelements - e0 < W) ? Nelements - e0 : W;
+
+    // pad incomplete batches by repeating the last element
+    dlong element[W];
+    for(int l = 0; l < W; ++l)
+      element[l] = elementList[e0 + ((l < Nlanes) ? l : Nlanes - 1)];
+
+    for(int k = 0; k < p_Nq; k++)
+      for(int j = 0; j < p_Nq; ++j)
+        for(int i = 0; i < p_Nq; ++i) {
+          const int n = i + j * p_Nq + k * p_Nq * p_Nq;
+          for(int l = 0; l < W; ++l)
+            s_q[k][j][i][l] = q[n + element[l] * p_Np];
+        }
+
+    for(int k = 0; k < p_Nq; ++k)
+      for(int j = 0; j < p_Nq; ++j)
+        for(int i = 0; i < p_Nq; ++i) {
+          const int n = k * p_Nq * p_Nq + j * p_Nq + i;
+
+          #pragma omp simd
+          for(int l = 0; l < W; ++l) {
+            const dlong gbase = element[l] * p_Nggeo * p_Np + n;
+            const dfloat r_G00 = ggeo[gbase + p_G00ID * p_Np];
+            const dfloat r_G01 = ggeo[gbase + p_G01ID * p_Np];
+            const dfloat r_G11 = ggeo[gbase + p_G11ID * p_Np];
+            const dfloat r_G12 = ggeo[gbase + p_G12ID * p_Np];
+            const dfloat r_G02 = ggeo[gbase + p_G02ID * p_Np];
+            const dfloat r_G22 = ggeo[gbase + p_G22ID * p_Np];
+
+            const dlong id = element[l] * p_Np + n;
+            const dfloat r_lam0 = lambda0[p_lambda*id + 0 * loffset];
+
+            dfloat qr = 0;
+            dfloat qs = 0;
+            dfloat qt = 0;
+
+            for(int m = 0; m < p_Nq; m++){
+              qr += S[m*p_Nq + i] * s_q[k][j][m][l];
+              qs += S[m*p_Nq + j] * s_q[k][m][i][l];
+              qt += S[m*p_Nq + k] * s_q[m][j][i][l];
+            }
+
+            dfloat Gqr = r_G00 * qr;
+            Gqr += r_G01 * qs;
+            Gqr += r_G02 * qt;
+
+            dfloat Gqs = r_G01 * qr;
+            Gqs += r_G11 * qs;
+            Gqs += r_G12 * qt;
+
+            dfloat Gqt = r_G02 * qr;
+            Gqt += r_G12 * qs;
+            Gqt += r_G22 * qt;
+
+            s_Gqr[k][j][i][l] = r_lam0 * Gqr;
+            s_Gqs[k][j][i][l] = r_lam0 * Gqs;
+            s_Gqt[k][j][i][l] = r_lam0 * Gqt;
+          }
+        }
+
+    for(int k = 0; k < p_Nq; k++)
+      for(int j = 0; j < p_Nq; ++j)
+        for(int i = 0; i < p_Nq; ++i) {
+          const int n = k * p_Nq * p_Nq + j * p_Nq + i;
+
+          dfloat r_Aq[W];
+
+          #pragma omp simd
+          for(int l = 0; l < W; ++l) {
+            dfloat r_Aqr = 0, r_Aqs = 0, r_Aqt = 0;
+
+            for(int m = 0; m < p_Nq; m++){
+              r_Aqr += D[m*p_Nq+i] * s_Gqr[k][j][m][l];
+              r_Aqs += D[m*p_Nq+j] * s_Gqs[k][m][i][l];
+              r_Aqt += D[m*p_Nq+k] * s_Gqt[m][j][i][l];
+            }
+
+            dfloat r_Aq0 = 0;
+#ifndef p_poisson
+            const dlong gbase = element[l] * p_Nggeo * p_Np + n;
+            const dlong id = element[l] * p_Np + n;
+            const dfloat r_lam1 = lambda1[p_lambda*id + 0 * loffset];
+            r_Aq0 = ggeo[gbase + p_GWJID * p_Np] * r_lam1 * s_q[k][j][i][l];
+#endif
+            r_Aq[l] = r_Aqr + r_Aqs + r_Aqt + r_Aq0;
+          }
+
+          for(int l = 0; l < Nlanes; ++l)
+            Aq[element[l] * p_Np + n] = r_Aq[l];
+        }
+  }
+}
+
+#undef p_simdWidth
+#undef SIMD_KERNEL_NAME
+#endif
@@ -0,0 +1,122 @@
+// geometric factors are recomputed from the element coordinates
+// XYZ[e][3][p_Np] instead of reading 7 words per node from ggeo
+#if p_knl == 0
+extern "C" void FUNC(ellipticPartialAxCoeffIsoparametricHex3D_v0)(const dlong & Nelements,
+                        const dlong & offset,
+                        const dlong & loffset,
+                        const dlong* __restrict__ elementList,
+                        const dfloat* __restrict__ XYZ,
+                        const dfloat* __restrict__ gllzw,
+                        const dfloat* __restrict__ D,
+                        const dfloat* __restrict__ S,
+                        const dfloat* __restrict__ lambda0,
+                        const dfloat* __restrict__ lambda1,
+                        const dfloat* __restrict__ q,
+                        dfloat* __restrict__ Aq )
+{
+  dfloat s_x[p_Nq][p_Nq][p_Nq];
+  dfloat s_y[p_Nq][p_Nq][p_Nq];
+  dfloat s_z[p_Nq][p_Nq][p_Nq];
+  dfloat s_q[p_Nq][p_Nq][p_Nq];
+  dfloat s_Gqr[p_Nq][p_Nq][p_Nq];
+  dfloat s_Gqs[p_Nq][p_Nq][p_Nq];
+  dfloat s_Gqt[p_Nq][p_Nq][p_Nq];
+  dfloat s_GwJ[p_Nq][p_Nq][p_Nq];
+
+  const dfloat *w = gllzw + p_Nq;
+
+#ifdef __NEKRS__OMP__
+  #pragma omp parallel for private(s_x, s_y, s_z, s_q, s_Gqr, s_Gqs, s_Gqt, s_GwJ)
+#endif
+  for(dlong e = 0; e < Nelements; ++e) {
+    const dlong element = elementList[e];
+
+    for(int k = 0; k < p_Nq; k++)
+      for(int j = 0; j < p_Nq; ++j)
+        for(int i = 0; i < p_Nq; ++i) {
+          const int n = i + j * p_Nq + k * p_Nq * p_Nq;
+          s_q[k][j][i] = q[n + element * p_Np];
+          s_x[k][j][i] = XYZ[n + 0 * p_Np + element * 3 * p_Np];
+          s_y[k][j][i] = XYZ[n + 1 * p_Np + element * 3 * p_Np];
+          s_z[k][j][i] = XYZ[n + 2 * p_Np + element * 3 * p_Np];
+        }
+
+    for(int k = 0; k < p_Nq; ++k)
+      for(int j = 0; j < p_Nq; ++j)
+        for(int i = 0; i < p_Nq; ++i) {
+          dfloat xr = 0, xs = 0, xt = 0;
+          dfloat yr = 0, ys = 0, yt = 0;
+          dfloat zr = 0, zs = 0, zt = 0;
+
+          for(int m = 0; m < p_Nq; m++) {
+            xr += D[i*p_Nq + m] * s_x[k][j][m];
+            xs += D[j*p_Nq + m] * s_x[k][m][i];
+            xt += D[k*p_Nq + m] * s_x[m][j][i];
+
+            yr += D[i*p_Nq + m] * s_y[k][j][m];
+            ys += D[j*p_Nq + m] * s_y[k][m][i];
+            yt += D[k*p_Nq + m] * s_y[m][j][i];
+
+            zr += D[i*p_Nq + m] * s_z[k][j][m];
+            zs += D[j*p_Nq + m] * s_z[k][m][i];
+            zt += D[k*p_Nq + m] * s_z[m][j][i];
+          }
+
+          const dfloat J = xr * (ys * zt - zs * yt) - yr * (xs * zt - zs * xt) + zr * (xs * yt - ys * xt);
+
+          const dfloat rx = (ys * zt - zs * yt), ry = -(xs * zt - zs * xt), rz = (xs * yt - ys * xt);
+          const dfloat sx = -(yr * zt - zr * yt), sy = (xr * zt - zr * xt), sz = -(xr * yt - yr * xt);
+          const dfloat tx = (yr * zs - zr * ys), ty = -(xr * zs - zr * xs), tz = (xr * ys - yr * xs);
+
+          const dfloat W = w[i] * w[j] * w[k];
+          const dfloat sc = W / J;
+
+          const dfloat r_G00 = sc * (rx * rx + ry * ry + rz * rz);
+          const dfloat r_G01 = sc * (rx * sx + ry * sy + rz * sz);
+          const dfloat r_G02 = sc * (rx * tx + ry * ty + rz * tz);
+          const dfloat r_G11 = sc * (sx * sx + sy * sy + sz * sz);
+          const dfloat r_G12 = sc * (sx * tx + sy * ty + sz * tz);
+          const dfloat r_G22 = sc * (tx * tx + ty * ty + tz * tz);
+          s_GwJ[k][j][i] = W * J;
+
+          const dlong id = element * p_Np + k * p_Nq * p_Nq + j * p_Nq + i;
+          const dfloat r_lam0 = lambda0[p_lambda*id + 0 * loffset];
+
+          dfloat qr = 0;
+          dfloat qs = 0;
+          dfloat qt = 0;
+
+          for(int m = 0; m < p_Nq; m++){
+            qr += S[m*p_Nq + i] * s_q[k][j][m];
+            qs += S[m*p_Nq + j] * s_q[k][m][i];
+            qt += S[m*p_Nq + k] * s_q[m][j][i];
+          }
+
+          s_Gqr[k][j][i] = r_lam0 * (r_G00 * qr + r_G01 * qs + r_G02 * qt);
+          s_Gqs[k][j][i] = r_lam0 * (r_G01 * qr + r_G11 * qs + r_G12 * qt);
+          s_Gqt[k][j][i] = r_lam0 * (r_G02 * qr + r_G12 * qs + r_G22 * qt);
+        }
+
+    for(int k = 0; k < p_Nq; k++)
+      for(int j = 0; j < p_Nq; ++j)
+        for(int i = 0; i < p_Nq; ++i) {
+          const dlong id = element * p_Np + k * p_Nq * p_Nq + j * p_Nq + i;
+
+          dfloat r_Aq = 0;
+#ifndef p_poisson
+          const dfloat r_lam1 = lambda1[p_lambda*id + 0 * loffset];
+          r_Aq = s_GwJ[k][j][i] * r_lam1 * s_q[k][j][i];
+#endif
+          dfloat r_Aqr = 0, r_Aqs = 0, r_Aqt = 0;
+
+          for(int m = 0; m < p_Nq; m++){
+            r_Aqr += D[m*p_Nq+i] * s_Gqr[k][j][m];
+            r_Aqs += D[m*p_Nq+j] * s_Gqs[k][m][i];
+            r_Aqt += D[m*p_Nq+k] * s_Gqt[m][j][i];
+          }
+
+          Aq[id] = r_Aqr + r_Aqs + r_Aqt + r_Aq;
+        }
+  }
+}
+#endif
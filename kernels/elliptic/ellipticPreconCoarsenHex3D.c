@@ -24,6 +24,7 @@
 
  */
 extern "C" void FUNC(ellipticPreconCoarsenHex3D)(const dlong& Nelements,
+                                            const dlong* __restrict__ elementList,
                                             const pfloat* __restrict__  R,
                                             const pfloat* __restrict__  qf,
                                             pfloat* __restrict__  qc)
@@ -45,7 +46,8 @@ extern "C" void FUNC(ellipticPreconCoarsenHex3D)(const dlong& Nelements,
 #ifdef __NEKRS__OMP__
   #pragma omp parallel for private(s_Pq, r_q, s_q)
 #endif
-  for(dlong e = 0; e < Nelements; ++e) {
+  for(dlong eo = 0; eo < Nelements; ++eo) {
+    const dlong e = elementList[eo];
 
     for(int j = 0; j < p_NqFine; ++j)
       for(int i = 0; i < p_NqFine; ++i) {
@@ -1,6 +1,7 @@
 
 
-extern "C" void FUNC(fusedFDM)(
+#if p_knl == 0
+extern "C" void FUNC(fusedFDM_v0)(
   const dlong& Nelements,
   const dlong *elementList,
   pfloat* __restrict__ Su,
@@ -222,3 +223,209 @@ extern "C" void FUNC(fusedFDM)(
 #undef getIdx
 #undef work1
 }
+#endif
+
+// elements are batched across SIMD lanes (lane index innermost),
+// variant 1 targets 256-bit and variant 2 512-bit vector units
+#if p_knl == 1
+#define p_simdWidth (32 / sizeof(pfloat))
+#define SIMD_KERNEL_NAME fusedFDM_v1
+#elif p_knl == 2
+#define p_simdWidth (64 / sizeof(pfloat))
+#define SIMD_KERNEL_NAME fusedFDM_v2
+#endif
+
+#if p_knl == 1 || p_knl == 2
+extern "C" void FUNC(SIMD_KERNEL_NAME)(
+  const dlong& Nelements,
+  const dlong *elementList,
+  pfloat* __restrict__ Su,
+  const pfloat* __restrict__ S_x,
+  const pfloat* __restrict__ S_y,
+  const pfloat* __restrict__ S_z,
+  const pfloat* __restrict__ inv_L,
+#if p_restrict
+  const pfloat* __restrict__ wts,
+#endif
+  pfloat* __restrict__ u
+  )
+{
+  constexpr int W = p_simdWidth;
+#define getIdx(k,j,i,e) ((k)*p_Nq_e*p_Nq_e+(j)*p_Nq_e+(i)+(e)*p_Nq_e*p_Nq_e*p_Nq_e)
+  alignas(64) pfloat S_x_e[p_Nq_e][p_Nq_e][W];
+  alignas(64) pfloat S_y_e[p_Nq_e][p_Nq_e][W];
+  alignas(64) pfloat S_z_e[p_Nq_e][p_Nq_e][W];
+  alignas(64) pfloat work1[p_Nq_e][p_Nq_e][p_Nq_e][W];
+  alignas(64) pfloat work2[p_Nq_e][p_Nq_e][p_Nq_e][W];
+  alignas(64) pfloat tmp[p_Nq_e][p_Nq_e][p_Nq_e][W];
+
+  const dlong Nbatches = (Nelements + W - 1) / W;
+
+#ifdef __NEKRS__OMP__
+  #pragma omp parallel for private(S_x_e, S_y_e, S_z_e, work1, work2, tmp)
+#endif
+  for (dlong batch = 0; batch < Nbatches; ++batch) {
+    const dlong e0 = batch * W;
+    const int Nlanes = (Nelements - e0 < W) ? Nelements - e0 : W;
+
+    // pad incomplete batches by repeating the last element
+    dlong element[W];
+    for (int l = 0; l < W; ++l)
+      element[l] = elementList[e0 + ((l < Nlanes) ? l : Nlanes - 1)];
+
+    // face corrections are applied in place (like in the reference variant)
+    for (int l = 0; l < Nlanes; ++l) {
+      const dlong elem = element[l];
+      for (int a = 1; a < p_Nq_e - 1; ++a) {
+        for (int b = 1; b < p_Nq_e - 1; ++b) {
+          u[getIdx(0, a, b, elem)] -= u[getIdx(2, a, b, elem)];
+          u[getIdx(p_Nq_e - 1, a, b, elem)] -= u[getIdx(p_Nq_e - 3, a, b, elem)];
+          u[getIdx(a, 0, b, elem)] -= u[getIdx(a, 2, b, elem)];
+          u[getIdx(a, p_Nq_e - 1, b, elem)] -= u[getIdx(a, p_Nq_e - 3, b, elem)];
+          u[getIdx(a, b, 0, elem)] -= u[getIdx(a, b, 2, elem)];
+          u[getIdx(a, b, p_Nq_e - 1, elem)] -= u[getIdx(a, b, p_Nq_e - 3, elem)];
+        }
+      }
+    }
+
+    for (int i = 0; i < p_Nq_e; i++) {
+      for (int j = 0; j < p_Nq_e; j++) {
+        const int ij = j + i * p_Nq_e;
+        for (int l = 0; l < W; ++l) {
+          S_x_e[i][j][l] = S_x[ij + element[l] * p_Nq_e * p_Nq_e];
+          S_y_e[i][j][l] = S_y[ij + element[l] * p_Nq_e * p_Nq_e];
+          S_z_e[i][j][l] = S_z[ij + element[l] * p_Nq_e * p_Nq_e];
+        }
+      }
+    }
+
+    for (int k = 0; k < p_Nq_e; k++)
+      for (int j = 0; j < p_Nq_e; j++)
+        for (int i = 0; i < p_Nq_e; i++)
+          for (int l = 0; l < W; ++l)
+            work1[k][j][i][l] = u[getIdx(k, j, i, element[l])];
+
+    for (int k = 0; k < p_Nq_e; k++) {
+      for (int j = 0; j < p_Nq_e; j++) {
+        for (int i = 0; i < p_Nq_e; i++) {
+          #pragma omp simd
+          for (int e = 0; e < W; ++e) {
+            pfloat value = 0.0;
+            for (int l = 0; l < p_Nq_e; l++)
+              value += S_x_e[l][j][e] * work1[k][i][l][e];
+            work2[k][i][j][e] = value;
+          }
+        }
+      }
+    }
+    for (int k = 0; k < p_Nq_e; k++) {
+      for (int j = 0; j < p_Nq_e; j++) {
+        for (int i = 0; i < p_Nq_e; i++) {
+          #pragma omp simd
+          for (int e = 0; e < W; ++e) {
+            pfloat value = 0.0;
+            for (int l = 0; l < p_Nq_e; l++)
+              value += S_y_e[l][j][e] * work2[k][l][i][e];
+            tmp[j][k][i][e] = value;
+          }
+        }
+      }
+    }
+    for (int k = 0; k < p_Nq_e; k++) {
+      for (int j = 0; j < p_Nq_e; j++) {
+        for (int i = 0; i < p_Nq_e; i++) {
+          const int v = i + j * p_Nq_e + k * p_Nq_e * p_Nq_e;
+          #pragma omp simd
+          for (int e = 0; e < W; ++e) {
+            pfloat value = 0.0;
+            for (int l = 0; l < p_Nq_e; l++)
+              value += S_z_e[l][k][e] * tmp[j][l][i][e];
+            work2[k][i][j][e] = value * inv_L[v + element[e] * p_Nq_e * p_Nq_e * p_Nq_e];
+          }
+        }
+      }
+    }
+    for (int k = 0; k < p_Nq_e; k++) {
+      for (int j = 0; j < p_Nq_e; j++) {
+        for (int i = 0; i < p_Nq_e; i++) {
+          #pragma omp simd
+          for (int e = 0; e < W; ++e) {
+            pfloat value = 0.0;
+            for (int l = 0; l < p_Nq_e; l++)
+              value += S_x_e[i][l][e] * work2[k][l][j][e];
+            tmp[k][j][i][e] = value;
+          }
+        }
+      }
+    }
+    for (int k = 0; k < p_Nq_e; k++) {
+      for (int j = 0; j < p_Nq_e; j++) {
+        for (int i = 0; i < p_Nq_e; i++) {
+          #pragma omp simd
+          for (int e = 0; e < W; ++e) {
+            pfloat value = 0.0;
+            for (int l = 0; l < p_Nq_e; l++)
+              value += S_y_e[j][l][e] * tmp[k][l][i][e];
+            work2[j][k][i][e] = value;
+          }
+        }
+      }
+    }
+    for (int k = 0; k < p_Nq_e; k++) {
+      for (int j = 0; j < p_Nq_e; j++) {
+        for (int i = 0; i < p_Nq_e; i++) {
+          #pragma omp simd
+          for (int e = 0; e < W; ++e) {
+            pfloat value = 0.0;
+            for (int l = 0; l < p_Nq_e; l++)
+              value += S_z_e[k][l][e] * work2[j][l][i][e];
+            tmp[k][j][i][e] = value;
+          }
+        }
+      }
+    }
+
+#if (!p_restrict)
+    for (int k = 0; k < p_Nq_e; k++)
+      for (int j = 0; j < p_Nq_e; j++)
+        for (int i = 0; i < p_Nq_e; i++)
+          for (int l = 0; l < Nlanes; ++l)
+            Su[getIdx(k, j, i, element[l])] = tmp[k][j][i][l];
+
+    for (int a = 1; a < p_Nq_e - 1; ++a) {
+      for (int b = 1; b < p_Nq_e - 1; ++b) {
+        for (int l = 0; l < W; ++l) {
+          work2[0][a][b][l] = tmp[0][a][b][l];
+          work2[p_Nq_e - 1][a][b][l] = tmp[p_Nq_e - 1][a][b][l];
+          work2[a][0][b][l] = tmp[a][0][b][l];
+          work2[a][p_Nq_e - 1][b][l] = tmp[a][p_Nq_e - 1][b][l];
+          work2[a][b][0][l] = tmp[a][b][0][l];
+          work2[a][b][p_Nq_e - 1][l] = tmp[a][b][p_Nq_e - 1][l];
+        }
+      }
+    }
+
+    for (int k = 0; k < p_Nq_e; k++)
+      for (int j = 0; j < p_Nq_e; j++)
+        for (int i = 0; i < p_Nq_e; i++)
+          for (int l = 0; l < Nlanes; ++l)
+            u[getIdx(k, j, i, element[l])] = work2[k][j][i][l];
+#else
+    for (int k = 0; k < p_Nq; ++k) {
+      for (int j = 0; j < p_Nq; ++j) {
+        for (int i = 0; i < p_Nq; ++i) {
+          for (int l = 0; l < Nlanes; ++l) {
+            const dlong idx = i + j * p_Nq + k * p_Nq * p_Nq + element[l] * p_Nq * p_Nq * p_Nq;
+            Su[idx] = tmp[k + 1][j + 1][i + 1][l] * wts[idx];
+          }
+        }
+      }
+    }
+#endif
+  }
+#undef getIdx
+}
+
+#undef p_simdWidth
+#undef SIMD_KERNEL_NAME
+#endif
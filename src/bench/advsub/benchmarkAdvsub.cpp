@@ -376,14 +376,20 @@ occa::kernel benchmarkAdvsub(int Nfields,
   };
 
   auto kernelAndTime =
-      benchmarkKernel(advSubKernelBuilder, kernelRunner, printCallBack, kernelVariants, NtestsOrTargetTime);
+      benchmarkKernel(advSubKernelBuilder,
+                      kernelRunner,
+                      printCallBack,
+                      kernelVariants,
+                      NtestsOrTargetTime,
+                      (isScalar ? "cds/" : "nrs/") + kernelName,
+                      props);
 
   if (kernelAndTime.first.properties().has("defines/p_knl") &&
       platform->options.compareArgs("BUILD ONLY", "FALSE")) {
     int bestKernelVariant = static_cast<int>(kernelAndTime.first.properties()["defines/p_knl"]);
 
-    // print only the fastest kernel
-    if (verbosity == 1) {
+    // print only the fastest kernel (no timing if taken from the tuning database)
+    if (verbosity == 1 && kernelAndTime.second > 0) {
       printPerformanceInfo(bestKernelVariant, kernelAndTime.second, 0, false);
     }
   }
@@ -152,6 +152,7 @@ int main(int argc, char** argv)
 
   platform = platform_t::getInstance(options, MPI_COMM_WORLD, MPI_COMM_WORLD); 
   platform->options.setArgs("BUILD ONLY", "FALSE");
+  platform->options.setArgs("KERNEL TUNING", "BENCHMARK");
 #ifdef _OPENMP
   const int Nthreads = omp_get_max_threads();
 #else
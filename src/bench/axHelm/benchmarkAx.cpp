@@ -103,6 +103,11 @@ occa::kernel benchmarkAx(int Nelements,
   std::string kernelName = "elliptic";
   if (Ndim > 1) {
     kernelName += stressForm ? "Stress" : "Block";
+    // generic variant for an arbitrary number of uncoupled fields
+    if (!stressForm && Ndim != 3) {
+      kernelName += "N";
+      props["defines/p_Nfields"] = Ndim;
+    }
   }
   kernelName += "PartialAx";
   kernelName += "Coeff";
@@ -122,6 +127,10 @@ occa::kernel benchmarkAx(int Nelements,
       kernelName += "Ngeom";
     }
   }
+  else if (computeGeom) {
+    // curved elements, geometric factors are recomputed from the GLL coordinates
+    kernelName += "Isoparametric";
+  }
   kernelName += "Hex3D";
 
   auto benchmarkAxWithPrecision = [&](auto sampleWord) {
@@ -132,7 +141,8 @@ occa::kernel benchmarkAx(int Nelements,
     std::vector<int> kernelVariants;
 
     if (platform->serial) {
-      const int Nkernels = 1;
+      // variants 1 and 2 batch elements across 256-bit and 512-bit SIMD lanes
+      const int Nkernels = (kernelName == "ellipticPartialAxCoeffHex3D") ? 3 : 1;
       for (int knl = 0; knl < Nkernels; ++knl)
         kernelVariants.push_back(knl);
     }
@@ -162,6 +172,12 @@ occa::kernel benchmarkAx(int Nelements,
         props["defines/n_plane"] = n_plane;
         props["defines/pts_per_thread"] = Nq/n_plane;              
       }
+      if (kernelName == "ellipticBlockNPartialAxCoeffHex3D") {
+        kernelVariants.push_back(0);
+      }
+      if (kernelName == "ellipticPartialAxCoeffIsoparametricHex3D") {
+        kernelVariants.push_back(0);
+      }
       if (kernelName == "ellipticBlockPartialAxCoeffHex3D") {
         const int Nkernels = 2;
         for (int knl = 0; knl < Nkernels; ++knl)
@@ -312,7 +328,7 @@ occa::kernel benchmarkAx(int Nelements,
       const dfloat GDOFPerSecond = (Nelements * Ndim * (N * N * N) / elapsed) / 1.e9;
 
       size_t bytesMoved = Ndim * 2 * Np * wordSize; // x, Ax
-      bytesMoved += 6 * Np_g * wordSize;            // geo
+      bytesMoved += (computeGeom ? 3 : 6) * Np_g * wordSize; // geo
 
       if(!poisson || stressForm)
         bytesMoved += 1 * Np * wordSize; // Jw
@@ -380,14 +396,20 @@ occa::kernel benchmarkAx(int Nelements,
     };
 
     auto kernelAndTime =
-        benchmarkKernel(axKernelBuilder, kernelRunner, printCallBack, kernelVariants, NtestsOrTargetTime);
+        benchmarkKernel(axKernelBuilder,
+                        kernelRunner,
+                        printCallBack,
+                        kernelVariants,
+                        NtestsOrTargetTime,
+                        kernelName + suffix,
+                        props);
 
     if (kernelAndTime.first.properties().has("defines/p_knl") &&
         platform->options.compareArgs("BUILD ONLY", "FALSE")) {
       int bestKernelVariant = static_cast<int>(kernelAndTime.first.properties()["defines/p_knl"]);
 
-      // print only the fastest kernel
-      if (verbosity == 1) {
+      // print only the fastest kernel (no timing if taken from the tuning database)
+      if (verbosity == 1 && kernelAndTime.second > 0) {
         printPerformanceInfo(bestKernelVariant, kernelAndTime.second, 0, false);
       }
     }
@@ -134,6 +134,7 @@ int main(int argc, char** argv)
 
   platform = platform_t::getInstance(options, MPI_COMM_WORLD, MPI_COMM_WORLD);
   platform->options.setArgs("BUILD ONLY", "FALSE");
+  platform->options.setArgs("KERNEL TUNING", "BENCHMARK");
   const int verbosity = 2;
   if (Ntests != -1) {
     benchmarkAx(Nelements,
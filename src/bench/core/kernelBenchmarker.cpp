@@ -1,7 +1,14 @@
 #include "kernelBenchmarker.hpp"
 #include <limits>
+#include <algorithm>
+#include <map>
+#include <fstream>
+#include <filesystem>
+#include <unistd.h>
 #include "nrs.hpp"
 
+namespace fs = std::filesystem;
+
 namespace {
 double run(int Nsamples, std::function<void(occa::kernel &)> kernelRunner, occa::kernel &kernel)
 {
@@ -16,53 +23,60 @@ double run(int Nsamples, std::function<void(occa::kernel &)> kernelRunner, occa:
   platform->device.finish();
   return (MPI_Wtime() - start) / Nsamples;
 }
-} // namespace
-std::pair<occa::kernel, double>
-benchmarkKernel(std::function<occa::kernel(int kernelVariant)> kernelBuilder,
-                std::function<void(occa::kernel &)> kernelRunner,
-                std::function<void(int kernelVariant, double tKernel, int Ntests)> printCallback,
-                const std::vector<int> &kernelVariants,
-                int Ntests)
-{
-  occa::kernel fastestKernel;
-  double fastestTime = std::numeric_limits<double>::max();
-
-  for (auto &&kernelVariant : kernelVariants) {
 
-    MPI_Barrier(platform->comm.mpiComm);
-    auto candidateKernel = kernelBuilder(kernelVariant);
+// persistent winners, keyed by backend, device (arch), kernel name and build properties
+std::map<std::string, int> tuningDatabase;
+bool tuningDatabaseLoaded = false;
 
-    if (!candidateKernel.isInitialized())
-      continue;
-
-    if(platform->options.compareArgs("BUILD ONLY", "FALSE")){
-      // warmup
-      double elapsed = run(1, kernelRunner, candidateKernel);
-
-      double candidateKernelTiming = run(Ntests, kernelRunner, candidateKernel);
-      double tMax;
-      double tMin;
-      MPI_Allreduce(&candidateKernelTiming, &tMax, 1, MPI_DOUBLE, MPI_MAX, platform->comm.mpiComm);
-      MPI_Allreduce(&candidateKernelTiming, &tMin, 1, MPI_DOUBLE, MPI_MIN, platform->comm.mpiComm);
-
-      const double tRatio = tMax/tMin;
-      if (platform->comm.mpiRank == 0 && tRatio > 1.1)
-        printf("WARNING: kernel timings differ by up to %.2f across ranks!\n", tRatio);
-
-      candidateKernelTiming = tMax;
+fs::path tuningDatabaseFile()
+{
+  return fs::path(getenv("NEKRS_CACHE_DIR")) / "kernelTuning.db";
+}
 
-      if (candidateKernelTiming < fastestTime) {
-        fastestTime = candidateKernelTiming;
-        fastestKernel = candidateKernel;
-      }
+// derived from the build properties shared by all variants, nothing is built
+std::string tuningKey(const std::string &name, const occa::properties &props)
+{
+  return platform->device.mode() + ":" + platform->device.occaDevice().hash().getString() + ":" + name + ":" +
+         props.hash().getString();
+}
 
-      printCallback(kernelVariant, candidateKernelTiming, Ntests);
-    } else {
-      fastestKernel = candidateKernel;
+// collective, rank 0 owns the database
+int tuningLookup(const std::string &key)
+{
+  int variant = -1;
+  if (platform->comm.mpiRank == 0) {
+    if (!tuningDatabaseLoaded) {
+      std::ifstream file(tuningDatabaseFile());
+      std::string entry;
+      int entryVariant;
+      while (file >> entry >> entryVariant)
+        tuningDatabase[entry] = entryVariant;
+      tuningDatabaseLoaded = true;
     }
+    if (tuningDatabase.count(key))
+      variant = tuningDatabase.at(key);
   }
+  MPI_Bcast(&variant, 1, MPI_INT, 0, platform->comm.mpiComm);
+  return variant;
+}
 
-  return std::make_pair(fastestKernel, fastestTime);
+void tuningStore(const std::string &key, int variant)
+{
+  if (platform->comm.mpiRank)
+    return;
+
+  tuningDatabase[key] = variant;
+
+  const auto fileName = tuningDatabaseFile();
+  // concurrent jobs may share the cache directory
+  const auto tmpName = fs::path(fileName.string() + "." + std::to_string(getpid()) + ".tmp");
+  fs::create_directories(fileName.parent_path());
+  {
+    std::ofstream file(tmpName, std::ios::trunc);
+    for (auto &&[entry, entryVariant] : tuningDatabase)
+      file << entry << " " << entryVariant << "\n";
+  }
+  fs::rename(tmpName, fileName);
 }
 
 std::pair<occa::kernel, double>
@@ -70,11 +84,50 @@ benchmarkKernel(std::function<occa::kernel(int kernelVariant)> kernelBuilder,
                 std::function<void(occa::kernel &)> kernelRunner,
                 std::function<void(int kernelVariant, double tKernel, int Ntests)> printCallback,
                 const std::vector<int> &kernelVariants,
-                double targetTime)
+                std::function<int(double tWarmup)> numberOfTests,
+                const std::string &tuningName,
+                const occa::properties &tuningProps)
 {
   occa::kernel fastestKernel;
   double fastestTime = std::numeric_limits<double>::max();
 
+  // standalone benchmarks do not set KERNEL TUNING and always measure
+  const bool buildOnly = platform->options.compareArgs("BUILD ONLY", "TRUE");
+  const bool useDatabase = !buildOnly && !tuningName.empty() &&
+                           (platform->options.compareArgs("KERNEL TUNING", "DATABASE") ||
+                            platform->options.compareArgs("KERNEL TUNING", "RETUNE") ||
+                            platform->options.compareArgs("KERNEL TUNING", "PINNED"));
+
+  std::string key;
+  if (useDatabase) {
+    key = tuningKey(tuningName, tuningProps);
+
+    if (!platform->options.compareArgs("KERNEL TUNING", "RETUNE")) {
+      const int storedVariant = tuningLookup(key);
+      if (std::find(kernelVariants.begin(), kernelVariants.end(), storedVariant) != kernelVariants.end()) {
+        MPI_Barrier(platform->comm.mpiComm);
+        auto storedKernel = kernelBuilder(storedVariant);
+        if (storedKernel.isInitialized()) {
+          if (platform->comm.mpiRank == 0 && platform->options.compareArgs("VERBOSE", "TRUE"))
+            printf("%s: using stored kernelVer=%d\n", tuningName.c_str(), storedVariant);
+          return std::make_pair(storedKernel, -1.0);
+        }
+      }
+
+      // reproducible fallback, never benchmark
+      if (platform->options.compareArgs("KERNEL TUNING", "PINNED")) {
+        for (auto &&kernelVariant : kernelVariants) {
+          MPI_Barrier(platform->comm.mpiComm);
+          fastestKernel = kernelBuilder(kernelVariant);
+          if (fastestKernel.isInitialized())
+            return std::make_pair(fastestKernel, -1.0);
+        }
+        return std::make_pair(fastestKernel, fastestTime);
+      }
+    }
+  }
+
+  int fastestVariant = -1;
   for (auto &&kernelVariant : kernelVariants) {
 
     MPI_Barrier(platform->comm.mpiComm);
@@ -83,13 +136,13 @@ benchmarkKernel(std::function<occa::kernel(int kernelVariant)> kernelBuilder,
     if (!candidateKernel.isInitialized())
       continue; // remove variant if it doesn't compile
 
-    if(platform->options.compareArgs("BUILD ONLY", "FALSE")){
+    if (!buildOnly) {
 
       // warmup
       double elapsed = run(1, kernelRunner, candidateKernel);
 
       // evaluation
-      int Ntests = std::max(1, static_cast<int>(targetTime / elapsed));
+      int Ntests = numberOfTests(elapsed);
       MPI_Allreduce(MPI_IN_PLACE, &Ntests, 1, MPI_INT, MPI_MAX, platform->comm.mpiComm);
 
       double candidateKernelTiming = run(Ntests, kernelRunner, candidateKernel);
@@ -107,6 +160,7 @@ benchmarkKernel(std::function<occa::kernel(int kernelVariant)> kernelBuilder,
       if (candidateKernelTiming < fastestTime) {
         fastestTime = candidateKernelTiming;
         fastestKernel = candidateKernel;
+        fastestVariant = kernelVariant;
       }
 
       printCallback(kernelVariant, candidateKernelTiming, Ntests);
@@ -115,5 +169,47 @@ benchmarkKernel(std::function<occa::kernel(int kernelVariant)> kernelBuilder,
     }
   }
 
+  if (useDatabase && fastestVariant >= 0)
+    tuningStore(key, fastestVariant);
+
   return std::make_pair(fastestKernel, fastestTime);
 }
+} // namespace
+
+std::pair<occa::kernel, double>
+benchmarkKernel(std::function<occa::kernel(int kernelVariant)> kernelBuilder,
+                std::function<void(occa::kernel &)> kernelRunner,
+                std::function<void(int kernelVariant, double tKernel, int Ntests)> printCallback,
+                const std::vector<int> &kernelVariants,
+                int Ntests,
+                const std::string &tuningName,
+                const occa::properties &tuningProps)
+{
+  return benchmarkKernel(
+      kernelBuilder,
+      kernelRunner,
+      printCallback,
+      kernelVariants,
+      [Ntests](double) { return Ntests; },
+      tuningName,
+      tuningProps);
+}
+
+std::pair<occa::kernel, double>
+benchmarkKernel(std::function<occa::kernel(int kernelVariant)> kernelBuilder,
+                std::function<void(occa::kernel &)> kernelRunner,
+                std::function<void(int kernelVariant, double tKernel, int Ntests)> printCallback,
+                const std::vector<int> &kernelVariants,
+                double targetTime,
+                const std::string &tuningName,
+                const occa::properties &tuningProps)
+{
+  return benchmarkKernel(
+      kernelBuilder,
+      kernelRunner,
+      printCallback,
+      kernelVariants,
+      [targetTime](double elapsed) { return std::max(1, static_cast<int>(targetTime / elapsed)); },
+      tuningName,
+      tuningProps);
+}
@@ -1,17 +1,25 @@
 #include "occa.hpp"
 #include <utility>
 #include <functional>
+#include <string>
+
+// a non-empty tuningName (with the build properties shared by all variants)
+// keys the persistent tuning database, see KERNEL TUNING
 
 std::pair<occa::kernel, double>
 benchmarkKernel(std::function<occa::kernel(int kernelVariant)> kernelBuilder,
                 std::function<void(occa::kernel &)> kernelRunner,
                 std::function<void(int kernelVariant, double tKernel, int Ntests)> printCallback,
                 const std::vector<int> &kernelVariants,
-                int Ntests);
+                int Ntests,
+                const std::string &tuningName = "",
+                const occa::properties &tuningProps = occa::properties());
 
 std::pair<occa::kernel, double>
 benchmarkKernel(std::function<occa::kernel(int kernelVariant)> kernelBuilder,
                 std::function<void(occa::kernel &)> kernelRunner,
                 std::function<void(int kernelVariant, double tKernel, int Ntests)> printCallback,
                 const std::vector<int> &kernelVariants,
-                double targetTime);
+                double targetTime,
+                const std::string &tuningName = "",
+                const occa::properties &tuningProps = occa::properties());
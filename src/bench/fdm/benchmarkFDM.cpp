@@ -83,7 +83,10 @@ occa::kernel benchmarkFDM(int Nelements,
     constexpr int Nkernels = 5;
     std::vector<int> kernelVariants;
     if (platform->serial) {
-      kernelVariants.push_back(0);
+      // variants 1 and 2 batch elements across 256-bit and 512-bit SIMD lanes
+      for (int knl = 0; knl < 3; ++knl) {
+        kernelVariants.push_back(knl);
+      }
     }
     else {
       for (int knl = 0; knl < Nkernels; ++knl) {
@@ -96,8 +99,7 @@ occa::kernel benchmarkFDM(int Nelements,
     // only a single choice, no need to run benchmark
     if (kernelVariants.size() == 1 || !requiresBenchmark) {
       auto newProps = props;
-      if (!platform->serial)
-        newProps["defines/p_knl"] = kernelVariants.front();
+      newProps["defines/p_knl"] = kernelVariants.front();
 
       const std::string kernelName = "fusedFDM";
       const std::string ext = platform->serial ? ".c" : ".okl";
@@ -130,8 +132,7 @@ occa::kernel benchmarkFDM(int Nelements,
     occa::kernel referenceKernel;
     {
       auto newProps = props;
-      if (!platform->serial)
-        newProps["defines/p_knl"] = kernelVariants.front();
+      newProps["defines/p_knl"] = kernelVariants.front();
 
       const std::string kernelName = "fusedFDM";
       const std::string ext = platform->serial ? ".c" : ".okl";
@@ -149,8 +150,7 @@ occa::kernel benchmarkFDM(int Nelements,
 
     auto fdmKernelBuilder = [&](int kernelVariant) {
       auto newProps = props;
-      if (!platform->serial)
-        newProps["defines/p_knl"] = kernelVariant;
+      newProps["defines/p_knl"] = kernelVariant;
 
       const std::string kernelName = "fusedFDM";
       const std::string ext = platform->serial ? ".c" : ".okl";
@@ -253,14 +253,20 @@ occa::kernel benchmarkFDM(int Nelements,
     };
 
     auto kernelAndTime =
-        benchmarkKernel(fdmKernelBuilder, kernelRunner, printCallBack, kernelVariants, NtestsOrTargetTime);
+        benchmarkKernel(fdmKernelBuilder,
+                        kernelRunner,
+                        printCallBack,
+                        kernelVariants,
+                        NtestsOrTargetTime,
+                        "fusedFDM" + suffix,
+                        props);
 
     if (kernelAndTime.first.properties().has("defines/p_knl") &&
         platform->options.compareArgs("BUILD ONLY", "FALSE")) {
       int bestKernelVariant = static_cast<int>(kernelAndTime.first.properties()["defines/p_knl"]);
 
-      // print only the fastest kernel
-      if (verbosity == 1) {
+      // print only the fastest kernel (no timing if taken from the tuning database)
+      if (verbosity == 1 && kernelAndTime.second > 0) {
         printPerformanceInfo(bestKernelVariant, kernelAndTime.second, 0, false);
       }
     }
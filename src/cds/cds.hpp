@@ -22,6 +22,12 @@ struct cds_t
   dlong fieldOffsetSum;
   mesh_t* meshV;
   elliptic_t* solver[NSCALAR_MAX];
+
+  // scalars [blockFirst, blockFirst + blockNfields) are solved as one block system
+  int blockFirst = 0;
+  int blockNfields = 0;
+  elliptic_t* blockSolver = nullptr;
+  occa::memory o_blockEllipticCoeff;
   neknek_t* neknek;
 
   int NVfields;            // Number of velocity fields
@@ -57,6 +63,7 @@ struct cds_t
 
   occa::memory o_relUrst;
   occa::memory o_Urst;
+  int UrstHead = 0; // ring buffer head, history level k is stored in slot (UrstHead + k) % nEXT
 
   //EXTBDF data
   dfloat* coeffEXT, * coeffBDF, * coeffSubEXT;
@@ -117,5 +124,12 @@ struct cds_t
 };
 
 occa::memory cdsSolve(int i, cds_t* cds, dfloat time, int stage);
+occa::memory cdsSolveBlock(cds_t* cds, dfloat time, int stage);
+
+// contiguous range of scalars requesting solver = pcg+block (Nfields = 0 if none)
+void cdsBlockScalars(int& first, int& Nfields);
+
+// compute state of the block, all members have to be switched on/off together
+bool cdsBlockCompute(cds_t* cds);
 
 #endif
@@ -1,4 +1,5 @@
 #include <limits>
+#include <vector>
 #include "nrs.hpp"
 #include "linAlg.hpp"
 
@@ -50,3 +51,132 @@ occa::memory cdsSolve(const int is, cds_t* cds, dfloat time, int stage)
 }
 
 
+
+void cdsBlockScalars(int &first, int &Nfields)
+{
+  first = 0;
+  Nfields = 0;
+
+  int Nscalar = 0;
+  platform->options.getArgs("NUMBER OF SCALARS", Nscalar);
+
+  // scalar00 may live on a different (CHT) mesh, the block starts at scalar01
+  std::vector<int> members;
+  for (int is = 1; is < Nscalar; is++) {
+    const std::string sid = scalarDigitStr(is);
+    if (platform->options.compareArgs("SCALAR" + sid + " SOLVER", "NONE"))
+      continue;
+    if (platform->options.compareArgs("SCALAR" + sid + " BLOCK SOLVER", "TRUE"))
+      members.push_back(is);
+  }
+  if (members.size() < 2)
+    return;
+
+  nrsCheck(members.back() - members.front() + 1 != static_cast<int>(members.size()),
+           platform->comm.mpiComm,
+           EXIT_FAILURE,
+           "%s\n",
+           "scalar block solver requires a contiguous range of scalars!");
+
+  const std::vector<std::string> keys = {"SOLVER",
+                                         "PRECONDITIONER",
+                                         "INITIAL GUESS",
+                                         "SOLVER TOLERANCE",
+                                         "MAXIMUM ITERATIONS",
+                                         "LINEAR SOLVER STOPPING CRITERION",
+                                         "RESIDUAL PROJECTION VECTORS",
+                                         "RESIDUAL PROJECTION START",
+                                         "ELLIPTIC COEFF FIELD",
+                                         "ELLIPTIC PRECO COEFF FIELD"};
+  const std::string sidFirst = scalarDigitStr(members.front());
+  for (auto &&is : members) {
+    const std::string sid = scalarDigitStr(is);
+    for (auto &&key : keys) {
+      nrsCheck(platform->options.getArgs("SCALAR" + sid + " " + key) !=
+                   platform->options.getArgs("SCALAR" + sidFirst + " " + key),
+               platform->comm.mpiComm,
+               EXIT_FAILURE,
+               "scalar%s and scalar%s have different %s settings but are part of the same block solver!\n",
+               sidFirst.c_str(),
+               sid.c_str(),
+               key.c_str());
+    }
+  }
+
+  first = members.front();
+  Nfields = members.size();
+}
+
+bool cdsBlockCompute(cds_t *cds)
+{
+  const int first = cds->blockFirst;
+  for (int is = first + 1; is < first + cds->blockNfields; is++) {
+    nrsCheck(cds->compute[is] != cds->compute[first], platform->comm.mpiComm, EXIT_FAILURE,
+             "scalar%s and scalar%s are solved as a block and cannot be switched on/off separately!\n",
+             scalarDigitStr(first).c_str(), scalarDigitStr(is).c_str());
+  }
+  return cds->compute[first];
+}
+
+occa::memory cdsSolveBlock(cds_t *cds, dfloat time, int stage)
+{
+  const int Nfields = cds->blockNfields;
+  const int first = cds->blockFirst;
+  const std::string sid = scalarDigitStr(first);
+  const dlong fieldOffset = cds->fieldOffset[first];
+  const auto fieldBytes = fieldOffset * sizeof(dfloat);
+  mesh_t *mesh = cds->meshV;
+
+  platform->timer.tic("scalar rhs", 1);
+  for (int fld = 0; fld < Nfields; fld++) {
+    const int is = first + fld;
+
+    cds->setEllipticCoeffKernel(mesh->Nlocal,
+                                cds->g0 * cds->idt,
+                                cds->fieldOffsetScan[is],
+                                Nfields * fieldOffset,
+                                (cds->o_BFDiag.size()) ? 1 : 0,
+                                cds->o_diff,
+                                cds->o_rho,
+                                cds->o_BFDiag,
+                                cds->o_blockEllipticCoeff + fld * fieldBytes);
+
+    occa::memory o_Si = cds->o_S.slice(cds->fieldOffsetScan[is] * sizeof(dfloat), fieldBytes);
+    auto o_diff_i = cds->o_diff + cds->fieldOffsetScan[is] * sizeof(dfloat);
+    auto o_rho_i = cds->o_rho + cds->fieldOffsetScan[is] * sizeof(dfloat);
+
+    // rhs of all block members is stored after the Nfields solution slots
+    auto o_rhs_i = platform->o_mempool.o_ptr + (Nfields + fld) * fieldBytes;
+    o_rhs_i.copyFrom(cds->o_BF, fieldBytes, 0, cds->fieldOffsetScan[is] * sizeof(dfloat));
+    cds->neumannBCKernel(mesh->Nelements,
+                         mesh->o_sgeo,
+                         mesh->o_vmapM,
+                         mesh->o_EToB,
+                         is,
+                         time,
+                         fieldOffset,
+                         mesh->o_x,
+                         mesh->o_y,
+                         mesh->o_z,
+                         cds->o_Ue,
+                         o_Si,
+                         cds->o_EToB[is],
+                         o_diff_i,
+                         o_rho_i,
+                         *(cds->o_usrwrk),
+                         o_rhs_i);
+  }
+  platform->timer.toc("scalar rhs");
+
+  occa::memory o_rhs = platform->o_mempool.o_ptr.slice(Nfields * fieldBytes);
+  occa::memory o_x = platform->o_mempool.slice0;
+
+  const occa::memory &o_S0 =
+      (platform->options.compareArgs("SCALAR" + sid + " INITIAL GUESS", "EXTRAPOLATION") && stage == 1)
+          ? cds->o_Se
+          : cds->o_S;
+  o_x.copyFrom(o_S0, Nfields * fieldBytes, 0, cds->fieldOffsetScan[first] * sizeof(dfloat));
+  ellipticSolve(cds->blockSolver, o_rhs, o_x);
+
+  return o_x;
+}
@@ -4,6 +4,7 @@
 
 #include "linAlg.hpp"
 #include "nrs.hpp"
+#include "subCycling.hpp"
 
 static void flops(mesh_t *mesh, int Nfields)
 {
@@ -213,20 +214,37 @@ scalarSubCycleMovingMesh(cds_t *cds, int nEXT, dfloat time, int is, occa::memory
   return o_p0;
 }
 
-occa::memory scalarSubCycle(cds_t *cds, int nEXT, dfloat time, int is, occa::memory o_U, occa::memory o_S)
+occa::memory scalarSubCycle(cds_t *cds, int nEXT, dfloat time, int is, int Nfields, occa::memory o_U, occa::memory o_S)
 {
-  std::string sid = scalarDigitStr(is);
-
   linAlg_t *linAlg = platform->linAlg;
 
+  // scalars is, ..., is+Nfields-1 share the velocity history and are advanced together,
+  // initialization, BDF sum and gather-scatter are batched while volume and RK update
+  // kernels are still launched per field
+  // mempool layout (in units of fieldOffset):
+  //   [0, Nfields)              : sub-problem solutions
+  //   [Nfields, 2*Nfields)      : solutions at the beginning of the substep
+  //   [(2+rk)*Nfields, ...)     : rhs of RK stage rk
+  const dlong fieldOffset = cds->fieldOffset[is];
+  const dlong batchOffset = Nfields * fieldOffset;
+  const auto Nbyte = batchOffset * sizeof(dfloat);
+
+  nrsCheck((2 + cds->nRK) * Nbyte > platform->o_mempool.bytesAllocated,
+           MPI_COMM_SELF, EXIT_FAILURE,
+           "mempool too small to subcycle %d scalars!\n", Nfields);
+
+  occa::memory o_S0 = platform->o_mempool.slice0;
+  occa::memory o_S1 = platform->o_mempool.slice0 + batchOffset * sizeof(dfloat);
+  occa::memory o_rhs = platform->o_mempool.slice0 + 2 * batchOffset * sizeof(dfloat);
+
   // Solve for Each SubProblem
   for (int torder = (nEXT - 1); torder >= 0; torder--) {
     // Initialize SubProblem Velocity i.e. Ud = U^(t-torder*dt)
     const dlong toffset =
         cds->fieldOffsetScan[is] + torder * cds->fieldOffsetSum;
     cds->subCycleInitU0Kernel(cds->mesh[0]->Nlocal,
-        1,
-        cds->fieldOffset[is],
+        Nfields,
+        fieldOffset,
         torder,
         nEXT,
         toffset,
@@ -234,7 +252,7 @@ occa::memory scalarSubCycle(cds_t *cds, int nEXT, dfloat time, int is, occa::mem
         cds->coeffBDF[torder],
         cds->mesh[0]->o_LMM,
         o_S,
-        platform->o_mempool.slice0);
+        o_S0);
 
     // Advance SubProblem to t^(n-torder+1)
     dfloat tsub = time;
@@ -245,10 +263,7 @@ occa::memory scalarSubCycle(cds_t *cds, int nEXT, dfloat time, int is, occa::mem
     for (int ststep = 0; ststep < cds->Nsubsteps; ++ststep) {
       const dfloat tstage = tsub + ststep * sdt;
 
-      platform->o_mempool.slice0.copyFrom(platform->o_mempool.slice0,
-          cds->fieldOffset[is] * sizeof(dfloat),
-          cds->fieldOffset[is] * sizeof(dfloat),
-          0);
+      o_S1.copyFrom(o_S0, Nbyte);
 
       for (int rk = 0; rk < cds->nRK; ++rk) {
         // Extrapolate velocity to subProblem stage time
@@ -274,108 +289,99 @@ occa::memory scalarSubCycle(cds_t *cds, int nEXT, dfloat time, int is, occa::mem
           extC[2] = (t - tn0) * (t - tn1) / ((tn2 - tn0) * (tn2 - tn1));
           break;
         }
-
-        if (cds->meshV->NglobalGatherElements) {
-          if (platform->options.compareArgs("ADVECTION TYPE", "CUBATURE"))
-            cds->subCycleStrongCubatureVolumeKernel(
-                cds->meshV->NglobalGatherElements,
-                cds->meshV->o_globalGatherElementList,
-                cds->meshV->o_cubDiffInterpT,
-                cds->meshV->o_cubInterpT,
-                cds->vFieldOffset,
-                cds->vCubatureOffset,
-                rk * cds->fieldOffset[is],
-                cds->mesh[0]->o_invLMM,
-                cds->mesh[0]->o_divU,
-                extC[0],
-                extC[1],
-                extC[2],
-                cds->o_Urst,
-                platform->o_mempool.slice0,
-                platform->o_mempool.slice2);
-          else
-            cds->subCycleStrongVolumeKernel(cds->meshV->NglobalGatherElements,
-                cds->meshV->o_globalGatherElementList,
-                cds->meshV->o_D,
-                cds->vFieldOffset,
-                rk * cds->fieldOffset[is],
-                cds->mesh[0]->o_invLMM,
-                cds->mesh[0]->o_divU,
-                extC[0],
-                extC[1],
-                extC[2],
-                cds->o_Urst,
-                platform->o_mempool.slice0,
-                platform->o_mempool.slice2);
-        }
-
-        occa::memory o_rhs;
-        if (rk == 0)
-          o_rhs = platform->o_mempool.slice2;
-        if (rk == 1)
-          o_rhs = platform->o_mempool.slice3;
-        if (rk == 2)
-          o_rhs = platform->o_mempool.slice4;
-        if (rk == 3)
-          o_rhs = platform->o_mempool.slice5;
-
-        oogs::start(
-            o_rhs, 1, cds->fieldOffset[is], ogsDfloat, ogsAdd, cds->gsh);
-
-        if (cds->meshV->NlocalGatherElements) {
-          if (platform->options.compareArgs("ADVECTION TYPE", "CUBATURE"))
-            cds->subCycleStrongCubatureVolumeKernel(
-                cds->meshV->NlocalGatherElements,
-                cds->meshV->o_localGatherElementList,
-                cds->meshV->o_cubDiffInterpT,
-                cds->meshV->o_cubInterpT,
-                cds->vFieldOffset,
-                cds->vCubatureOffset,
-                rk * cds->fieldOffset[is],
-                cds->mesh[0]->o_invLMM,
-                cds->mesh[0]->o_divU,
-                extC[0],
-                extC[1],
-                extC[2],
-                cds->o_Urst,
-                platform->o_mempool.slice0,
-                platform->o_mempool.slice2);
-          else
-            cds->subCycleStrongVolumeKernel(cds->meshV->NlocalGatherElements,
-                cds->meshV->o_localGatherElementList,
-                cds->meshV->o_D,
-                cds->vFieldOffset,
-                rk * cds->fieldOffset[is],
-                cds->mesh[0]->o_invLMM,
-                cds->mesh[0]->o_divU,
-                extC[0],
-                extC[1],
-                extC[2],
-                cds->o_Urst,
-                platform->o_mempool.slice0,
-                platform->o_mempool.slice2);
+        UrstSlotCoeffs(cds->UrstHead, cds->nEXT, extC);
+
+        auto volume = [&](dlong Nelements, occa::memory &o_elementList) {
+          for (int fld = 0; fld < Nfields; fld++) {
+            occa::memory o_Sfld = o_S0 + fld * fieldOffset * sizeof(dfloat);
+            occa::memory o_rhsFld = o_rhs + fld * fieldOffset * sizeof(dfloat);
+            if (platform->options.compareArgs("ADVECTION TYPE", "CUBATURE"))
+              cds->subCycleStrongCubatureVolumeKernel(Nelements,
+                  o_elementList,
+                  cds->meshV->o_cubDiffInterpT,
+                  cds->meshV->o_cubInterpT,
+                  cds->vFieldOffset,
+                  cds->vCubatureOffset,
+                  rk * batchOffset,
+                  cds->mesh[0]->o_invLMM,
+                  cds->mesh[0]->o_divU,
+                  extC[0],
+                  extC[1],
+                  extC[2],
+                  cds->o_Urst,
+                  o_Sfld,
+                  o_rhsFld);
+            else
+              cds->subCycleStrongVolumeKernel(Nelements,
+                  o_elementList,
+                  cds->meshV->o_D,
+                  cds->vFieldOffset,
+                  rk * batchOffset,
+                  cds->mesh[0]->o_invLMM,
+                  cds->mesh[0]->o_divU,
+                  extC[0],
+                  extC[1],
+                  extC[2],
+                  cds->o_Urst,
+                  o_Sfld,
+                  o_rhsFld);
+          }
+        };
+
+        if (cds->meshV->NglobalGatherElements)
+          volume(cds->meshV->NglobalGatherElements, cds->meshV->o_globalGatherElementList);
+
+        occa::memory o_rhsStage = o_rhs + rk * Nbyte;
+
+        oogs::start(o_rhsStage, Nfields, fieldOffset, ogsDfloat, ogsAdd, cds->gsh);
+
+        if (cds->meshV->NlocalGatherElements)
+          volume(cds->meshV->NlocalGatherElements, cds->meshV->o_localGatherElementList);
+
+        oogs::finish(o_rhsStage, Nfields, fieldOffset, ogsDfloat, ogsAdd, cds->gsh);
+
+        flops(cds->mesh[0], Nfields);
+
+        for (int fld = 0; fld < Nfields; fld++) {
+          const auto fldByte = fld * fieldOffset * sizeof(dfloat);
+          cds->subCycleRKUpdateKernel(cds->meshV->Nlocal,
+              rk,
+              sdt,
+              batchOffset,
+              cds->o_coeffsfRK,
+              cds->o_weightsRK,
+              o_S1 + fldByte,
+              o_rhs + fldByte,
+              o_S0 + fldByte);
         }
-
-        oogs::finish(
-            o_rhs, 1, cds->fieldOffset[is], ogsDfloat, ogsAdd, cds->gsh);
-
-        flops(cds->mesh[0], 1);
-
-        cds->subCycleRKUpdateKernel(cds->meshV->Nlocal,
-            rk,
-            sdt,
-            cds->fieldOffset[is],
-            cds->o_coeffsfRK,
-            cds->o_weightsRK,
-            platform->o_mempool.slice1,
-            platform->o_mempool.slice2,
-            platform->o_mempool.slice0);
       }
     }
   }
-  linAlg->axmy(cds->mesh[0]->Nlocal,
+  linAlg->axmyMany(cds->mesh[0]->Nlocal,
+      Nfields,
+      fieldOffset,
+      0,
       1.0,
       cds->mesh[0]->o_LMM,
-      platform->o_mempool.slice0);
-  return platform->o_mempool.slice0;
+      o_S0);
+  return o_S0;
+}
+
+int scalarSubCycleBatchSize(cds_t *cds, int is)
+{
+  // batched scalars have to live on the same mesh, be contiguous in o_S and
+  // fit into the exchange handle / mempool
+  auto mesh = [cds](int i) { return (i) ? cds->meshV : cds->mesh[0]; };
+  auto fitsMempool = [cds, is](int n) {
+    return (2 + cds->nRK) * n * cds->fieldOffset[is] * sizeof(dfloat) <= platform->o_mempool.bytesAllocated;
+  };
+
+  int nfld = 1;
+  while (nfld < cds->NVfields && is + nfld < cds->NSfields && fitsMempool(nfld + 1)) {
+    const int js = is + nfld;
+    if (!cds->compute[js] || mesh(js) != mesh(is) || cds->fieldOffset[js] != cds->fieldOffset[is])
+      break;
+    nfld++;
+  }
+  return nfld;
 }
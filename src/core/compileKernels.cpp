@@ -2,6 +2,7 @@
 #include "compileKernels.hpp"
 #include "bcMap.hpp"
 #include "elliptic.h"
+#include "cds.hpp"
 #include "mesh.h"
 #include "ogs.hpp"
 #include "ogsKernels.hpp"
@@ -51,11 +52,17 @@ void compileKernels() {
 
   if (Nscalars) {
     registerCdsKernels(kernelInfoBC);
+    int blockFirst, blockNfields;
+    cdsBlockScalars(blockFirst, blockNfields);
     for(int is = 0; is < Nscalars; is++){
       std::string sid = scalarDigitStr(is);
       const std::string section = "scalar" + sid;
       const int poisson = 0;
 
+      // block members share the solver of the first one
+      if(blockNfields && is > blockFirst && is < blockFirst + blockNfields)
+        continue;
+
       if(!platform->options.compareArgs("SCALAR" + sid + " SOLVER", "NONE")){
         registerEllipticKernels(section, poisson);
         registerEllipticPreconditionerKernels(section, poisson);
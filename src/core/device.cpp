@@ -13,6 +13,14 @@ void setOccaVars()
   if(getenv("NEKRS_CACHE_DIR"))
     cache_dir.assign(getenv("NEKRS_CACHE_DIR"));
 
+  // kernel binaries are content addressed, a shared location can be reused
+  // across cases, polynomial orders and restarts
+  if (!getenv("OCCA_CACHE_DIR") && getenv("NEKRS_KERNEL_CACHE_DIR")) {
+    const std::string path = std::string(getenv("NEKRS_KERNEL_CACHE_DIR")) + "/occa/";
+    occa::env::OCCA_CACHE_DIR = path;
+    setenv("OCCA_CACHE_DIR", path.c_str(), 1);
+  }
+
   if (!getenv("OCCA_CACHE_DIR")) {
     const std::string path= cache_dir + "/occa/";
     occa::env::OCCA_CACHE_DIR = path;
@@ -1,8 +1,32 @@
+#include <iomanip>
+#include <set>
 #include "nrssys.hpp"
 #include "kernelRequestManager.hpp"
 #include "platform.hpp"
 #include "fileUtils.hpp"
 
+namespace
+{
+// OCCA keys its cache directories on the hash of source, dependencies, properties
+// and compiler, collect the ones holding a binary before any build is issued
+std::set<std::string> cachedBuilds()
+{
+  std::set<std::string> hashes;
+  std::error_code ec;
+  for(auto&& entry : fs::directory_iterator(fs::path(occa::env::OCCA_CACHE_DIR) / "cache", ec)) {
+    if(fs::exists(entry.path() / "binary", ec))
+      hashes.insert(entry.path().filename().string());
+  }
+  return hashes;
+}
+
+bool cacheHit(occa::kernel kernel, const std::set<std::string>& cached)
+{
+  if(!kernel.isInitialized()) return false;
+  return cached.count(fs::path(kernel.binaryFilename()).parent_path().filename().string());
+}
+}
+
 kernelRequestManager_t::kernelRequestManager_t(const platform_t& m_platform)
 : kernelsProcessed(false),
   platformRef(m_platform)
@@ -29,8 +53,8 @@ kernelRequestManager_t::add(kernelRequest_t request, bool checkUnique)
              "request details: %s\n", request.to_string().c_str());
   }
 
-  const std::string fileName = request.fileName;
-  fileNameToRequestMap[fileName].insert(request);
+  const std::string buildKey = request.fileName + ":" + request.suffix + ":" + request.props.hash().getString();
+  buildKeyToRequestMap[buildKey].insert(request);
 }
 occa::kernel
 kernelRequestManager_t::get(const std::string& request, bool checkValid) const
@@ -74,7 +98,9 @@ kernelRequestManager_t::compile()
 
   kernelsProcessed = true;
 
-  constexpr int maxCompilingRanks {20};
+  int maxCompilingRanks = 20;
+  if(getenv("NEKRS_MAX_BUILD_RANKS"))
+    maxCompilingRanks = std::max(1, std::stoi(getenv("NEKRS_MAX_BUILD_RANKS")));
 
   const int rank = platform->cacheLocal ? platformRef.comm.localRank : platformRef.comm.mpiRank;
   const int ranksCompiling =
@@ -85,36 +111,37 @@ kernelRequestManager_t::compile()
         platformRef.comm.mpiCommSize
     );
 
-
-  std::vector<std::string> kernelFiles(fileNameToRequestMap.size());
-  
-  unsigned ctr = 0;
-  for(auto&& fileNameAndRequests : fileNameToRequestMap)
-  {
-    kernelFiles[ctr] = fileNameAndRequests.first;
-    ctr++;
-  }
+  // distinct builds are spread round-robin across the compiling ranks,
+  // requests resolving to the same binary stay on one rank
+  std::vector<std::string> buildKeys;
+  buildKeys.reserve(buildKeyToRequestMap.size());
+  for(auto&& buildKeyAndRequests : buildKeyToRequestMap)
+    buildKeys.push_back(buildKeyAndRequests.first);
 
   const auto& device = platformRef.device;
   auto& requestToKernel = requestToKernelMap;
-  auto& fileNameToRequest = fileNameToRequestMap;
-  auto compileKernels = [&kernelFiles, &requestToKernel, &fileNameToRequest, &device, rank, ranksCompiling](){
+  auto& buildKeyToRequest = buildKeyToRequestMap;
+  std::ostringstream cacheLog;
+  std::set<std::string> cached;
+  if(rank < ranksCompiling) cached = cachedBuilds();
+  auto compileKernels = [&buildKeys, &requestToKernel, &buildKeyToRequest, &device, &cacheLog, &cached, rank, ranksCompiling](){
     if(rank >= ranksCompiling) return;
-    const unsigned nFiles = kernelFiles.size();
-    for(unsigned fileId = 0; fileId < nFiles; ++fileId)
+    const unsigned nBuilds = buildKeys.size();
+    for(unsigned buildId = rank; buildId < nBuilds; buildId += ranksCompiling)
     {
-      if(fileId % ranksCompiling == rank){
-        const std::string fileName = kernelFiles[fileId];
-        for(auto && kernelRequest : fileNameToRequest[fileName]){
-          const std::string requestName = kernelRequest.requestName;
-          const std::string fileName = kernelRequest.fileName;
-          const std::string suffix = kernelRequest.suffix;
-          const occa::properties props = kernelRequest.props;
-
-          const bool buildRank0 = false;
-          auto kernel = device.buildKernel(fileName, props, suffix, buildRank0);
-          requestToKernel[requestName] = kernel;
-        }
+      for(auto && kernelRequest : buildKeyToRequest[buildKeys[buildId]]){
+        const std::string requestName = kernelRequest.requestName;
+        const std::string fileName = kernelRequest.fileName;
+        const std::string suffix = kernelRequest.suffix;
+        const occa::properties props = kernelRequest.props;
+
+        const double tStart = MPI_Wtime();
+        const bool buildRank0 = false;
+        auto kernel = device.buildKernel(fileName, props, suffix, buildRank0);
+        requestToKernel[requestName] = kernel;
+        cacheLog << (cacheHit(kernel, cached) ? "hit  " : "miss ")
+                 << std::fixed << std::setprecision(3) << MPI_Wtime() - tStart << "s "
+                 << requestName << "\n";
       }
     }
   };
@@ -151,4 +178,52 @@ kernelRequestManager_t::compile()
   loadKernels();
 
   occa::env::OCCA_CACHE_DIR = OCCA_CACHE_DIR0;
+
+  report(cacheLog.str());
+}
+
+void
+kernelRequestManager_t::report(const std::string& cacheLog) const
+{
+  const MPI_Comm comm = platformRef.comm.mpiComm;
+  const int rank = platformRef.comm.mpiRank;
+  const int size = platformRef.comm.mpiCommSize;
+
+  int len = cacheLog.size();
+  std::vector<int> counts(size);
+  MPI_Gather(&len, 1, MPI_INT, counts.data(), 1, MPI_INT, 0, comm);
+
+  std::vector<int> displs(size, 0);
+  for(int r = 1; r < size; r++)
+    displs[r] = displs[r - 1] + counts[r - 1];
+
+  std::vector<char> buf(rank == 0 ? displs[size - 1] + counts[size - 1] : 0);
+  MPI_Gatherv(cacheLog.c_str(), len, MPI_CHAR,
+              buf.data(), counts.data(), displs.data(), MPI_CHAR, 0, comm);
+
+  if(rank) return;
+
+  // node-local builds compile the same request on every node, keep one entry
+  std::map<std::string, std::string> entries;
+  std::istringstream ss(std::string(buf.begin(), buf.end()));
+  std::string line;
+  while(std::getline(ss, line)) {
+    const auto pos = line.rfind(' ');
+    entries.emplace(line.substr(pos + 1), line);
+  }
+
+  int hits = 0;
+  for(auto&& entry : entries)
+    if(entry.second.find("hit") == 0) hits++;
+  const int misses = entries.size() - hits;
+
+  const auto reportFile = fs::path(getenv("NEKRS_CACHE_DIR")) / "kernelCache.log";
+  std::ofstream ofs(reportFile, std::ofstream::out | std::ofstream::trunc);
+  for(auto&& entry : entries) {
+    ofs << entry.second << "\n";
+    if(platformRef.verbose) std::cout << entry.second << "\n";
+  }
+  ofs.close();
+
+  printf("kernel cache: %d hits, %d misses (see %s)\n", hits, misses, reportFile.c_str());
 }
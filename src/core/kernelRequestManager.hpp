@@ -75,9 +75,12 @@ private:
   bool kernelsProcessed;
   std::set<kernelRequest_t> kernels;
   std::map<std::string, occa::kernel> requestToKernelMap;
-  std::map<std::string, std::set<kernelRequest_t>> fileNameToRequestMap;
+  std::map<std::string, std::set<kernelRequest_t>> buildKeyToRequestMap;
 
   void add(kernelRequest_t request, bool assertUnique = true);
 
+  // collective, writes per request cache hit/miss and build time
+  void report(const std::string& cacheLog) const;
+
 };
 #endif /** kernelRequestManager_hpp_ **/
\ No newline at end of file
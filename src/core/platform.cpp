@@ -76,6 +76,11 @@ platform_t::platform_t(setupAide &_options, MPI_Comm _commg, MPI_Comm _comm)
            _comm, EXIT_FAILURE, 
            "NEKRS_CACHE_LOCAL=1 and NEKRS_CACHE_BCAST=1 is incompatible!", "");
 
+  // a shared kernel cache would be broadcasted as a whole on every startup
+  nrsCheck(cacheBcast && getenv("NEKRS_KERNEL_CACHE_DIR"),
+           _comm, EXIT_FAILURE, 
+           "NEKRS_KERNEL_CACHE_DIR and NEKRS_CACHE_BCAST=1 is incompatible!", "");
+
   srand48((long int)comm.mpiRank);
 
   oogs::gpu_mpi(std::stoi(getenv("NEKRS_GPU_MPI")));
@@ -45,7 +45,13 @@ void registerEllipticKernels(std::string section, int poissonEquation)
   kernelInfo["include_paths"].asArray();
   kernelInfo += meshKernelProperties(N);
 
-  const bool blockSolver = [&section]() {
+  int scalarBlockFirst, scalarBlockNfields;
+  cdsBlockScalars(scalarBlockFirst, scalarBlockNfields);
+  const bool scalarBlock = scalarBlockNfields && section == "scalar" + scalarDigitStr(scalarBlockFirst);
+
+  const bool blockSolver = [&section, scalarBlock]() {
+    if (scalarBlock)
+      return true;
     if (section == "velocity" && platform->options.compareArgs("VELOCITY BLOCK SOLVER", "TRUE"))
       return true;
     if (section == "velocity" && platform->options.compareArgs("VELOCITY STRESSFORMULATION", "TRUE"))
@@ -57,7 +63,7 @@ void registerEllipticKernels(std::string section, int poissonEquation)
     return false;
   }();
 
-  const int Nfields = (blockSolver) ? 3 : 1;
+  const int Nfields = (scalarBlock) ? scalarBlockNfields : (blockSolver) ? 3 : 1;
 
   const bool stressForm = [&section]() {
     if (section == "velocity" && platform->options.compareArgs("VELOCITY STRESSFORMULATION", "TRUE"))
@@ -151,11 +157,18 @@ void registerEllipticKernels(std::string section, int poissonEquation)
     std::string kernelNamePrefix = "elliptic";
     if (blockSolver)
       kernelNamePrefix += (stressForm) ? "Stress" : "Block";
+    if (blockSolver && !stressForm && Nfields != 3)
+      kernelNamePrefix += "N";
+
+    const bool recomputeGeom =
+        !blockSolver && platform->options.compareArgs(optionsPrefix + "ELLIPTIC GEOMETRY", "RECOMPUTE");
 
     kernelName = "Ax";
     kernelName += "Coeff";
     if (platform->options.compareArgs("ELEMENT MAP", "TRILINEAR"))
       kernelName += "Trilinear";
+    else if (recomputeGeom)
+      kernelName += "Isoparametric";
     kernelName += suffix;
 
     const std::string _kernelName = kernelNamePrefix + "Partial" + kernelName;
@@ -167,7 +180,7 @@ void registerEllipticKernels(std::string section, int poissonEquation)
                                 N,
                                 !coeffField,
                                 poissonEquation,
-                                false,
+                                recomputeGeom,
                                 sizeof(dfloat),
                                 Nfields,
                                 stressForm,
@@ -188,4 +201,9 @@ void registerEllipticKernels(std::string section, int poissonEquation)
   // PCG update
   fileName = oklpath + "ellipticBlockUpdatePCG" + fileNameExtension;
   platform->kernels.add(sectionIdentifier + "ellipticBlockUpdatePCG", fileName, kernelInfo);
+
+  if (platform->options.compareArgs(optionsPrefix + "SOLVER", "PIPELINED")) {
+    fileName = oklpath + "ellipticBlockUpdatePipelinedPCG" + fileNameExtension;
+    platform->kernels.add(sectionIdentifier + "ellipticBlockUpdatePipelinedPCG", fileName, kernelInfo);
+  }
 }
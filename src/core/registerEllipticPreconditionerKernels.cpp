@@ -1,8 +1,10 @@
 #include <compileKernels.hpp>
+#include <set>
 #include "nrs.hpp"
 #include "benchmarkFDM.hpp"
 #include "benchmarkAx.hpp"
 #include "ellipticPrecon.h" 
+#include "MGAutotuner.hpp"
 
 #include "re2Reader.hpp"
 
@@ -293,10 +295,19 @@ void registerMultiGridKernels(const std::string &section, int poissonEquation)
   if (levels.empty())
     return;
 
-  for (unsigned levelIndex = 1U; levelIndex < levels.size(); ++levelIndex) {
-    const int levelFine = levels[levelIndex - 1];
-    const int levelCoarse = levels[levelIndex];
-    registerMultigridLevelKernels(section, levelFine, levelCoarse, poissonEquation);
+  // the autotuner switches between level sets at runtime
+  std::vector<std::vector<int>> levelSets = {levels};
+  if (platform->options.compareArgs(optionsPrefix + "MULTIGRID AUTOTUNE", "TRUE"))
+    levelSets = MGAutotuneLevels(section);
+
+  std::set<std::pair<int, int>> levelPairs;
+  for (auto &&levelSet : levelSets) {
+    for (unsigned levelIndex = 1U; levelIndex < levelSet.size(); ++levelIndex) {
+      const int levelFine = levelSet[levelIndex - 1];
+      const int levelCoarse = levelSet[levelIndex];
+      if (levelPairs.insert({levelFine, levelCoarse}).second)
+        registerMultigridLevelKernels(section, levelFine, levelCoarse, poissonEquation);
+    }
   }
   const int coarseLevel = levels.back();
   if (platform->options.compareArgs(optionsPrefix + "MULTIGRID COARSE SOLVE", "TRUE")) {
@@ -337,7 +348,7 @@ void registerSEMFEMKernels(const std::string &section, int N, int poissonEquatio
   stiffnessKernelInfo["defines/p_Nq"] = Nq;
   stiffnessKernelInfo["defines/p_Np"] = Np;
   stiffnessKernelInfo["defines/p_rows_sorted"] = 1;
-  stiffnessKernelInfo["defines/p_cols_sorted"] = 0;
+  stiffnessKernelInfo["defines/p_cols_sorted"] = 1;
 
   const bool constructOnHost = !platform->device.deviceAtomic;
 
@@ -1,24 +1,57 @@
 #include <iostream>
 #include <string>
 #include <map>
+#include <unordered_map>
+#include <deque>
+#include <fstream>
 #include <algorithm>
 #include <tuple>
+#include <iomanip>
 
 #include "timer.hpp"
 #include "platform.hpp"
 #include "ogs.hpp"
-#include "orderedMap.hpp"
 
 namespace timer {
 namespace {
 struct tagData {
-  long long int count;
-  double hostElapsed;
-  double deviceElapsed;
-  double startTime;
+  std::string name;
+  long long int count = 0;
+  double hostElapsed = 0;
+  double deviceElapsed = 0;
+  double startTime = 0;
+  occa::streamTag startTag;
+  int parent = -1;
+  bool nested = false;
+};
+
+// interned tags, an id is the index into tags_ (deque keeps references stable)
+std::deque<tagData> tags_;
+std::unordered_map<std::string, int> ids_;
+
+// tags currently open, used to record the nesting
+std::vector<int> openTags;
+
+// device intervals are resolved lazily to avoid waiting on the stream in toc
+struct pendingDevice {
+  int id;
+  long long int event;
   occa::streamTag startTag;
+  occa::streamTag stopTag;
 };
-orderedMap<std::string, tagData> m_;
+std::vector<pendingDevice> pendingDevice_;
+constexpr size_t maxPendingDevice = 256;
+
+struct traceEvent {
+  int id;
+  double start;
+  double hostDuration;
+  double deviceDuration;
+};
+std::vector<traceEvent> trace_;
+constexpr size_t maxTraceEvents = 1 << 20;
+bool traceEnabled = false;
+double traceOrigin = 0;
 
 const int NEKRS_TIMER_INVALID_KEY = -1;
 const int NEKRS_TIMER_INVALID_METRIC = -2;
@@ -41,6 +74,75 @@ inline void sync()
 
 double tElapsedTimeSolve = 0;
 
+int findTag(const std::string &tag)
+{
+  auto it = ids_.find(tag);
+  return (it == ids_.end()) ? -1 : it->second;
+}
+
+int checkedId(const std::string &tag, const char *caller)
+{
+  const int id = findTag(tag);
+  if (id < 0 && enabled) {
+    printf("Error in %s: Invalid tag name %s\n", caller, tag.c_str());
+    MPI_Abort(comm_, 1);
+  }
+  return id;
+}
+
+tagData &checkedTag(int id, const char *caller)
+{
+  if (id < 0 || id >= static_cast<int>(tags_.size())) {
+    printf("Error in %s: Invalid tag id %d\n", caller, id);
+    MPI_Abort(comm_, 1);
+  }
+  return tags_[id];
+}
+
+void close(int id)
+{
+  auto it = std::find(openTags.rbegin(), openTags.rend(), id);
+  if (it != openTags.rend())
+    openTags.erase(std::next(it).base());
+}
+
+void open(int id)
+{
+  close(id);
+  auto &t = tags_[id];
+  if (!t.nested) {
+    t.parent = openTags.empty() ? -1 : openTags.back();
+    t.nested = true;
+  }
+  openTags.push_back(id);
+}
+
+long long int recordEvent(int id, double start, double stop)
+{
+  if (!traceEnabled || trace_.size() >= maxTraceEvents)
+    return -1;
+  trace_.push_back({id, start - traceOrigin, stop - start, -1});
+  return trace_.size() - 1;
+}
+
+void flushDevice()
+{
+  for (auto &&p : pendingDevice_) {
+    const double elapsed = device_.timeBetween(p.startTag, p.stopTag);
+    tags_[p.id].deviceElapsed += elapsed;
+    if (p.event >= 0)
+      trace_[p.event].deviceDuration = elapsed;
+  }
+  pendingDevice_.clear();
+}
+
+void addDevice(int id, long long int event, const occa::streamTag &stopTag)
+{
+  pendingDevice_.push_back({id, event, tags_[id].startTag, stopTag});
+  if (pendingDevice_.size() >= maxPendingDevice)
+    flushDevice();
+}
+
 auto sumAllMatchingTags(std::function<bool(std::string)> predicate, const std::string metric)
 {
   long long int count = 0;
@@ -62,6 +164,17 @@ auto sumAllMatchingTags(std::function<bool(std::string)> predicate, const std::s
   return std::make_tuple(elapsed, count);
 }
 
+std::string escapeJson(const std::string &in)
+{
+  std::string out;
+  for (auto c : in) {
+    if (c == '"' || c == '\\')
+      out += '\\';
+    out += c;
+  }
+  return out;
+}
+
 } // namespace
 
 timer_t::timer_t(MPI_Comm comm, occa::device device, int ifSyncDefault, int enableSync)
@@ -76,20 +189,57 @@ void timer_t::init(MPI_Comm comm, occa::device device, int ifSyncDefault, int en
   comm_ = comm;
   enable_sync_ = enableSync;
   enabled = 1;
+
+  const char *env = getenv("NEKRS_TIMER_TRACE");
+  traceEnabled = env && std::atoi(env);
+  traceOrigin = MPI_Wtime();
 }
 
-void timer_t::set(const std::string tag, double time, long long int count)
+int timer_t::id(const std::string &tag)
 {
-  m_[tag].startTime = time;
-  auto it = m_.find(tag);
-  if (it == m_.end()) {
-    printf("Error in set: Invalid tag name %s\n", tag.c_str());
-    MPI_Abort(comm_, 1);
-  }
+  auto it = ids_.find(tag);
+  if (it != ids_.end())
+    return it->second;
+
+  const int id = tags_.size();
+  tags_.emplace_back();
+  tags_.back().name = tag;
+  ids_[tag] = id;
+  return id;
+}
 
-  it->second.hostElapsed = time;
-  it->second.deviceElapsed = it->second.hostElapsed;
-  it->second.count = count;
+void timer_t::set(const std::string &tag, double time, long long int count)
+{
+  auto &t = tags_[id(tag)];
+  t.startTime = time;
+  t.hostElapsed = time;
+  t.deviceElapsed = t.hostElapsed;
+  t.count = count;
+}
+
+void timer_t::gsOverlapBegin(const std::string &tag)
+{
+  if (!enabled)
+    return;
+  tags_[id(tag + " gs window")].startTime = MPI_Wtime();
+}
+
+void timer_t::gsOverlapWait(const std::string &tag)
+{
+  if (!enabled)
+    return;
+  // wait for the local work so only the communication remains exposed
+  if (enable_sync_)
+    device_.finish();
+  tags_[id(tag + " gs exposed")].startTime = MPI_Wtime();
+}
+
+void timer_t::gsOverlapEnd(const std::string &tag)
+{
+  if (!enabled)
+    return;
+  hostToc(tag + " gs exposed");
+  hostToc(tag + " gs window");
 }
 
 void timer_t::enable() { enabled = 1; }
@@ -98,11 +248,13 @@ void timer_t::disable() { enabled = 0; }
 
 void timer_t::reset()
 {
-  for (auto &it : m_) {
-    it.second.startTime = 0;
-    it.second.hostElapsed = 0;
-    it.second.deviceElapsed = 0;
-    it.second.count = 0;
+  pendingDevice_.clear();
+  openTags.clear();
+  for (auto &t : tags_) {
+    t.startTime = 0;
+    t.hostElapsed = 0;
+    t.deviceElapsed = 0;
+    t.count = 0;
   }
   ogsResetTime();
 }
@@ -111,158 +263,152 @@ void timer_t::enableSync() { enable_sync_ = 1; }
 
 void timer_t::disableSync() { enable_sync_ = 0; }
 
-void timer_t::reset(const std::string tag)
+void timer_t::reset(const std::string &tag)
 {
-  std::map<std::string, tagData>::iterator it = m_.find(tag);
-  it->second.startTime = 0;
-  it->second.hostElapsed = 0;
-  it->second.deviceElapsed = 0;
-  it->second.count = 0;
+  const int id = findTag(tag);
+  if (id < 0)
+    return;
+  flushDevice();
+  auto &t = tags_[id];
+  t.startTime = 0;
+  t.hostElapsed = 0;
+  t.deviceElapsed = 0;
+  t.count = 0;
 }
 
 void timer_t::finalize() { reset(); }
 
-void timer_t::deviceTic(const std::string tag, int ifSync)
+void timer_t::deviceTic(const std::string &tag, int ifSync) { deviceTic(id(tag), ifSync); }
+
+void timer_t::deviceTic(const std::string &tag) { deviceTic(id(tag), ifSync()); }
+
+void timer_t::deviceTic(int id, int ifSync)
 {
   if (!enabled)
     return;
   if (ifSync)
     sync();
-  m_[tag].startTag = device_.tagStream();
+  auto &t = checkedTag(id, "deviceTic");
+  t.startTime = MPI_Wtime();
+  t.startTag = device_.tagStream();
+  open(id);
 }
 
-void timer_t::deviceTic(const std::string tag)
-{
-  if (!enabled)
-    return;
-  if (ifSync())
-    sync();
-  m_[tag].startTag = device_.tagStream();
-}
+void timer_t::deviceToc(const std::string &tag) { deviceToc(checkedId(tag, "deviceToc")); }
 
-void timer_t::deviceToc(const std::string tag)
+void timer_t::deviceToc(int id)
 {
   if (!enabled)
     return;
-  occa::streamTag stopTag = device_.tagStream();
-
-  std::map<std::string, tagData>::iterator it = m_.find(tag);
-  if (it == m_.end()) {
-    printf("Error in deviceToc: Invalid tag name %s\n", tag.c_str());
-    MPI_Abort(comm_, 1);
-  }
+  const auto stopTag = device_.tagStream();
+  const auto stopTime = MPI_Wtime();
 
-  it->second.deviceElapsed += device_.timeBetween(it->second.startTag, stopTag);
-  it->second.count++;
+  auto &t = checkedTag(id, "deviceToc");
+  close(id);
+  addDevice(id, recordEvent(id, t.startTime, stopTime), stopTag);
+  t.count++;
 }
 
-void timer_t::hostTic(const std::string tag, int ifSync)
+void timer_t::hostTic(const std::string &tag, int ifSync) { hostTic(id(tag), ifSync); }
+
+void timer_t::hostTic(const std::string &tag) { hostTic(id(tag), ifSync()); }
+
+void timer_t::hostTic(int id, int ifSync)
 {
   if (!enabled)
     return;
   if (ifSync)
     sync();
-  m_[tag].startTime = MPI_Wtime();
+  checkedTag(id, "hostTic").startTime = MPI_Wtime();
+  open(id);
 }
 
-void timer_t::hostTic(const std::string tag)
+void timer_t::hostToc(const std::string &tag) { hostToc(checkedId(tag, "hostToc")); }
+
+void timer_t::hostToc(int id)
 {
   if (!enabled)
     return;
-  if (ifSync())
-    sync();
-  m_[tag].startTime = MPI_Wtime();
+  const double stopTime = MPI_Wtime();
+
+  auto &t = checkedTag(id, "hostToc");
+  close(id);
+  recordEvent(id, t.startTime, stopTime);
+  t.hostElapsed += (stopTime - t.startTime);
+  t.count++;
 }
 
-void timer_t::hostToc(const std::string tag)
-{
-  if (!enabled)
-    return;
-  double stopTime = MPI_Wtime();
+void timer_t::tic(const std::string &tag, int ifSync) { tic(id(tag), ifSync); }
 
-  auto it = m_.find(tag);
-  if (it == m_.end()) {
-    printf("Error in deviceToc: Invalid tag name %s\n", tag.c_str());
-    MPI_Abort(comm_, 1);
-  }
+void timer_t::tic(const std::string &tag) { tic(id(tag), ifSync()); }
 
-  it->second.hostElapsed += (stopTime - it->second.startTime);
-  it->second.count++;
-}
+void timer_t::tic(int id) { tic(id, ifSync()); }
 
-void timer_t::tic(const std::string tag, int ifSync)
+void timer_t::tic(int id, int ifSync)
 {
   if (!enabled)
     return;
   if (ifSync)
     sync();
-  m_[tag].startTime = MPI_Wtime();
-  m_[tag].startTag = device_.tagStream();
+  auto &t = checkedTag(id, "tic");
+  t.startTime = MPI_Wtime();
+  t.startTag = device_.tagStream();
+  open(id);
 }
 
-void timer_t::tic(const std::string tag)
-{
-  if (!enabled)
-    return;
-  if (ifSync())
-    sync();
-  m_[tag].startTime = MPI_Wtime();
-  m_[tag].startTag = device_.tagStream();
-}
+void timer_t::toc(const std::string &tag) { toc(checkedId(tag, "toc")); }
 
-void timer_t::toc(const std::string tag)
+void timer_t::toc(int id)
 {
   if (!enabled)
     return;
-  auto stopTime = MPI_Wtime();
-  auto stopTag = device_.tagStream();
-
-  auto it = m_.find(tag);
-  if (it == m_.end()) {
-    printf("Error in deviceToc: Invalid tag name %s\n", tag.c_str());
-    MPI_Abort(comm_, 1);
-  }
-
-  it->second.hostElapsed += (stopTime - it->second.startTime);
-  it->second.deviceElapsed += device_.timeBetween(it->second.startTag, stopTag);
-  it->second.count++;
+  const auto stopTime = MPI_Wtime();
+  const auto stopTag = device_.tagStream();
+
+  auto &t = checkedTag(id, "toc");
+  close(id);
+  addDevice(id, recordEvent(id, t.startTime, stopTime), stopTag);
+  t.hostElapsed += (stopTime - t.startTime);
+  t.count++;
 }
 
-double timer_t::hostElapsed(const std::string tag)
+double timer_t::hostElapsed(const std::string &tag)
 {
-  auto it = m_.find(tag);
-  if (it == m_.end())
+  const int id = findTag(tag);
+  if (id < 0)
     return NEKRS_TIMER_INVALID_KEY;
-  return it->second.hostElapsed;
+  return tags_[id].hostElapsed;
 }
 
-double timer_t::deviceElapsed(const std::string tag)
+double timer_t::deviceElapsed(const std::string &tag)
 {
-  auto it = m_.find(tag);
-  if (it == m_.end())
+  const int id = findTag(tag);
+  if (id < 0)
     return NEKRS_TIMER_INVALID_KEY;
-  return it->second.deviceElapsed;
+  flushDevice();
+  return tags_[id].deviceElapsed;
 }
 
-long long int timer_t::count(const std::string tag)
+long long int timer_t::count(const std::string &tag)
 {
-  auto it = m_.find(tag);
-  if (it == m_.end())
+  const int id = findTag(tag);
+  if (id < 0)
     return NEKRS_TIMER_INVALID_KEY;
-  return it->second.count;
+  return tags_[id].count;
 }
 
-double timer_t::query(const std::string tag, const std::string metric)
+double timer_t::query(const std::string &tag, const std::string &metric)
 {
   int size;
   MPI_Comm_size(comm_, &size);
 
-  auto it = m_.find(tag);
-  if (it == m_.end())
+  const int id = findTag(tag);
+  if (id < 0)
     return NEKRS_TIMER_INVALID_KEY;
-  auto hostElapsed = it->second.hostElapsed;
-  auto deviceElapsed = it->second.deviceElapsed;
-  auto count = it->second.count;
+  flushDevice();
+  auto hostElapsed = tags_[id].hostElapsed;
+  auto deviceElapsed = tags_[id].deviceElapsed;
+  auto count = tags_[id].count;
 
   double retVal;
 
@@ -510,7 +656,7 @@ void timer_t::printRunStat(int step)
 
   for (int i = 15; i > 0; i--) {
     const std::string tag = "pressure preconditioner smoother N=" + std::to_string(i);
-    if (m_.find(tag) == m_.end())
+    if (findTag(tag) < 0)
       continue;
     printStatEntry("        pMG smoother    ", tag, "DEVICE:MAX", tPressurePreco);
   }
@@ -540,6 +686,25 @@ void timer_t::printRunStat(int step)
 
   printStatEntry("    gsMPI               ", gsTime, tElapsedTimeSolve);
 
+  // fraction of an overlapped gather-scatter not spent waiting for communication
+  const std::string gsWindow = " gs window";
+  for (auto &&tag : tags()) {
+    if (tag.size() <= gsWindow.size() ||
+        tag.compare(tag.size() - gsWindow.size(), gsWindow.size(), gsWindow))
+      continue;
+    const auto site = tag.substr(0, tag.size() - gsWindow.size());
+    const double tWindow = query(tag, "HOST:MAX");
+    const double tExposed = query(site + " gs exposed", "HOST:MAX");
+    if (rank == 0 && tWindow > 0) {
+      std::cout.unsetf(std::ios::scientific);
+      std::cout << "      overlap " << site << "  efficiency= " << std::fixed << std::setprecision(2)
+                << 1 - tExposed / tWindow << "  calls= " << count(tag) << "\n";
+      std::cout.unsetf(std::ios::fixed);
+      std::cout.setf(std::ios::scientific);
+      std::cout.precision(5);
+    }
+  }
+
   printStatEntry("    dotp                ", "dotp", "DEVICE:MAX", tElapsedTimeSolve);
 
   printStatEntry("    dotp multi          ", "dotpMulti", "DEVICE:MAX", tElapsedTimeSolve);
@@ -549,30 +714,133 @@ void timer_t::printRunStat(int step)
 
   std::cout.unsetf(std::ios::scientific);
   std::cout.precision(outPrecisionSave);
+
+  // hierarchical summary and per rank timeline
+  if (traceEnabled) {
+    printSummary();
+    writeTrace(platform->options.getArgs("CASENAME") + ".trace");
+  }
 }
 
 void timer_t::printAll()
 {
   if (platform->comm.mpiRank != 0)
     return;
+  flushDevice();
   std::cout << "Device timers: {\n";
-  for (auto &&[name, data] : m_) {
-    std::cout << "\t" << name << " " << data.deviceElapsed << ",\n";
+  for (auto &&t : tags_) {
+    std::cout << "\t" << t.name << " " << t.deviceElapsed << ",\n";
   }
   std::cout << "}\n";
 
   std::cout << "Host timers: {\n";
-  for (auto &&[name, data] : m_) {
-    std::cout << "\t" << name << " " << data.hostElapsed << ",\n";
+  for (auto &&t : tags_) {
+    std::cout << "\t" << t.name << " " << t.hostElapsed << ",\n";
   }
   std::cout << "}\n";
 }
 
+void timer_t::printSummary()
+{
+  int rank, size;
+  MPI_Comm_rank(comm_, &rank);
+  MPI_Comm_size(comm_, &size);
+
+  flushDevice();
+
+  // tags are matched by name using the list of rank 0
+  std::string names;
+  if (rank == 0) {
+    for (auto &&t : tags_)
+      names += t.name + '\n';
+  }
+  int bufSize = names.size();
+  MPI_Bcast(&bufSize, 1, MPI_INT, 0, comm_);
+  names.resize(bufSize);
+  MPI_Bcast(names.data(), bufSize, MPI_CHAR, 0, comm_);
+
+  std::vector<std::string> list;
+  std::istringstream is(names);
+  for (std::string name; std::getline(is, name);)
+    list.push_back(name);
+
+  const int n = list.size();
+  std::vector<double> tMin(n, 0), tMax(n, 0), tSum(n, 0);
+  std::vector<long long int> calls(n, 0);
+  for (int i = 0; i < n; i++) {
+    const int id = findTag(list[i]);
+    if (id < 0)
+      continue;
+    tMin[i] = tMax[i] = tSum[i] = tags_[id].deviceElapsed;
+    calls[i] = tags_[id].count;
+  }
+  MPI_Allreduce(MPI_IN_PLACE, tMin.data(), n, MPI_DOUBLE, MPI_MIN, comm_);
+  MPI_Allreduce(MPI_IN_PLACE, tMax.data(), n, MPI_DOUBLE, MPI_MAX, comm_);
+  MPI_Allreduce(MPI_IN_PLACE, tSum.data(), n, MPI_DOUBLE, MPI_SUM, comm_);
+  MPI_Allreduce(MPI_IN_PLACE, calls.data(), n, MPI_LONG_LONG_INT, MPI_MAX, comm_);
+
+  if (rank != 0)
+    return;
+
+  printf("\n>>> timer summary (device time across ranks):\n");
+  printf("%-48s %11s %11s %11s %6s %10s\n", "name", "max", "avg", "min", "imb", "calls");
+
+  std::function<void(int, int)> printTag = [&](int id, int depth) {
+    if (calls[id] > 0) {
+      const double avg = tSum[id] / size;
+      const auto name = std::string(2 * depth, ' ') + list[id];
+      printf("%-48s %11.4e %11.4e %11.4e %6.2f %10lld\n",
+             name.c_str(),
+             tMax[id],
+             avg,
+             tMin[id],
+             (avg > 0) ? tMax[id] / avg : 1.0,
+             calls[id]);
+    }
+    for (int i = 0; i < n; i++) {
+      if (tags_[i].parent == id)
+        printTag(i, depth + 1);
+    }
+  };
+  for (int i = 0; i < n; i++) {
+    if (tags_[i].parent < 0)
+      printTag(i, 0);
+  }
+  printf("\n");
+}
+
+void timer_t::writeTrace(const std::string &fileName)
+{
+  if (!traceEnabled)
+    return;
+
+  int rank;
+  MPI_Comm_rank(comm_, &rank);
+
+  flushDevice();
+
+  std::ofstream f(fileName + "." + std::to_string(rank) + ".json");
+  f << std::fixed << std::setprecision(3);
+  f << "{\"traceEvents\":[\n";
+  for (size_t i = 0; i < trace_.size(); i++) {
+    const auto &e = trace_[i];
+    f << "{\"name\":\"" << escapeJson(tags_[e.id].name) << "\",\"ph\":\"X\",\"pid\":" << rank
+      << ",\"tid\":0,\"ts\":" << 1e6 * e.start << ",\"dur\":" << 1e6 * e.hostDuration;
+    if (e.deviceDuration >= 0)
+      f << ",\"args\":{\"device\":" << 1e6 * e.deviceDuration << "}";
+    f << "}" << ((i + 1 < trace_.size()) ? ",\n" : "\n");
+  }
+  f << "]}\n";
+
+  if (rank == 0 && trace_.size() >= maxTraceEvents)
+    printf("timer trace truncated after %zu events\n", maxTraceEvents);
+}
+
 std::vector<std::string> timer_t::tags()
 {
   std::vector<std::string> entries;
-  auto &keys = m_.keys();
-  std::copy(keys.begin(), keys.end(), std::back_inserter(entries));
+  for (auto &&t : tags_)
+    entries.push_back(t.name);
   return entries;
 }
 
@@ -11,29 +11,44 @@ struct timer_t
 timer_t(MPI_Comm comm,occa::device device,int ifsync, int enable_sync);
 void init(MPI_Comm comm,occa::device device,int ifsync, int enable_sync);
 void reset();
-void reset(const std::string tag);
+void reset(const std::string &tag);
 void finalize();
 void enableSync();
 void disableSync();
 void enable();
 void disable();
 
-void tic(const std::string tag);
-void tic(const std::string tag,int ifSync);
-void toc(const std::string tag);
-void hostTic(const std::string tag);
-void hostTic(const std::string tag,int ifSync);
-void hostToc(const std::string tag);
-void deviceTic(const std::string tag);
-void deviceTic(const std::string tag,int ifSync);
-void deviceToc(const std::string tag);
-
-void set(const std::string tag, double time, long long int count = 1);
-
-double hostElapsed(const std::string tag);
-double deviceElapsed(const std::string tag);
-long long int count(const std::string tag);
-double query(const std::string tag,std::string metric);
+// interned tag id, cache it for frequently called regions to skip the name lookup
+int id(const std::string &tag);
+
+void tic(const std::string &tag);
+void tic(const std::string &tag,int ifSync);
+void tic(int id);
+void tic(int id,int ifSync);
+void toc(const std::string &tag);
+void toc(int id);
+void hostTic(const std::string &tag);
+void hostTic(const std::string &tag,int ifSync);
+void hostTic(int id,int ifSync);
+void hostToc(const std::string &tag);
+void hostToc(int id);
+void deviceTic(const std::string &tag);
+void deviceTic(const std::string &tag,int ifSync);
+void deviceTic(int id,int ifSync);
+void deviceToc(const std::string &tag);
+void deviceToc(int id);
+
+void set(const std::string &tag, double time, long long int count = 1);
+
+// overlapped gather-scatter accounting, call after oogs::start, before and after oogs::finish
+void gsOverlapBegin(const std::string &tag);
+void gsOverlapWait(const std::string &tag);
+void gsOverlapEnd(const std::string &tag);
+
+double hostElapsed(const std::string &tag);
+double deviceElapsed(const std::string &tag);
+long long int count(const std::string &tag);
+double query(const std::string &tag,const std::string &metric);
 void printRunStat(int step);
 void printStatEntry(std::string name, std::string tag, std::string type, double tNorm);
 void printStatEntry(std::string name, double time, double tNorm);
@@ -42,6 +57,13 @@ void printStatEntry(std::string name, double tTag, long long int nCalls, double
 // print every entry in the map
 void printAll();
 
+// min/avg/max across ranks of all tags, indented by nesting
+void printSummary();
+
+// Chrome trace (chrome://tracing, Perfetto) of all timed regions, one file per rank
+// recorded if NEKRS_TIMER_TRACE=1
+void writeTrace(const std::string &fileName);
+
 // obtain all tags registered with the timer
 std::vector<std::string> tags();
 };
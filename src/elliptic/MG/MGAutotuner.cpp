@@ -0,0 +1,275 @@
+#include <algorithm>
+
+#include "elliptic.h"
+#include "ellipticPrecon.h"
+#include "ellipticMultiGrid.h"
+#include "platform.hpp"
+#include "MGAutotuner.hpp"
+
+std::vector<std::vector<int>> MGAutotuneLevels(const std::string &section)
+{
+  int N;
+  platform->options.getArgs("POLYNOMIAL DEGREE", N);
+
+  std::vector<std::vector<int>> levelSets;
+  auto addLevels = [&](const std::vector<int> &levels) {
+    if (std::find(levelSets.begin(), levelSets.end(), levels) == levelSets.end())
+      levelSets.push_back(levels);
+  };
+
+  const std::vector<int> initialLevels = determineMGLevels(section);
+  addLevels(initialLevels);
+
+  // coarse solver kernels are registered for the configured coarse level only
+  const int Nc = initialLevels.back();
+  if (N > Nc) {
+    addLevels({N, Nc});
+    if (N > Nc + 1)
+      addLevels({N, (N + Nc + 1) / 2, Nc});
+
+    std::vector<int> levels;
+    for (int n = N; n > Nc; n -= 2)
+      levels.push_back(n);
+    levels.push_back(Nc);
+    addLevels(levels);
+  }
+
+  return levelSets;
+}
+
+namespace
+{
+std::string schedule(const std::vector<int> &levels, int degree)
+{
+  std::string s;
+  for (int i = 0; i < levels.size(); i++) {
+    s += "p=" + std::to_string(levels[i]);
+    if (i < levels.size() - 1)
+      s += "+degree=" + std::to_string(degree);
+    s += ",";
+  }
+  for (int i = levels.size() - 2; i >= 0; i--)
+    s += "p=" + std::to_string(levels[i]) + "+degree=" + std::to_string(degree) + ",";
+  s.pop_back();
+
+  return s;
+}
+} // namespace
+
+MGAutotuner_t::MGAutotuner_t(elliptic_t *elliptic_) : elliptic(elliptic_)
+{
+  setupAide &options = elliptic->options;
+
+  optionsPrefix = elliptic->name + " ";
+  std::transform(optionsPrefix.begin(), optionsPrefix.end(), optionsPrefix.begin(), [](unsigned char c) {
+    return std::toupper(c);
+  });
+
+  // keep the Chebyshev kind, vary the inner smoother
+  const std::string smoother = options.getArgs("MULTIGRID SMOOTHER");
+  std::string chebyshevType = "CHEBYSHEV";
+  if (smoother.find("FOURTHOPTCHEBYSHEV") != std::string::npos)
+    chebyshevType = "FOURTHOPTCHEBYSHEV";
+  else if (smoother.find("FOURTHCHEBYSHEV") != std::string::npos)
+    chebyshevType = "FOURTHCHEBYSHEV";
+
+  // Schwarz kernels are built for one restriction type only
+  const std::string schwarzType = (smoother.find("RAS") != std::string::npos) ? "RAS" : "ASM";
+
+  std::vector<std::string> smoothers = {smoother};
+  if (smoother.find("DAMPEDJACOBI") != std::string::npos)
+    smoothers.push_back(chebyshevType + "+" + schwarzType);
+  else
+    smoothers.push_back("DAMPEDJACOBI," + chebyshevType);
+
+  candidate_t initial;
+  initial.smoother = smoother;
+  initial.schedule = options.getArgs("MULTIGRID SCHEDULE");
+  initial.levels = std::vector<int>(elliptic->levels, elliptic->levels + elliptic->nLevels);
+  candidates.push_back(initial);
+
+  hierarchies.push_back({initial.levels, elliptic->precon, elliptic->levels});
+
+  // schedule equivalent to the initial configuration
+  std::string initialSchedule = initial.schedule;
+  if (initialSchedule.empty()) {
+    int degree = 3;
+    options.getArgs("MULTIGRID CHEBYSHEV DEGREE", degree);
+    initialSchedule = schedule(initial.levels, degree);
+  }
+
+  // level sets in the outer loop, each hierarchy is built only once
+  for (auto &&levels : MGAutotuneLevels(elliptic->name)) {
+    for (auto &&s : smoothers) {
+      for (int degree = 1; degree <= 3; degree++) {
+        candidate_t c;
+        c.smoother = s;
+        c.schedule = schedule(levels, degree);
+        c.levels = levels;
+        if (c.smoother == initial.smoother && c.schedule == initialSchedule)
+          continue;
+        candidates.push_back(c);
+      }
+    }
+  }
+
+  // start measuring once the initial guess projection space is filled
+  if (options.compareArgs("INITIAL GUESS", "PROJECTION") ||
+      options.compareArgs("INITIAL GUESS", "PROJECTION-ACONJ")) {
+    int nVecsProject = 8;
+    options.getArgs("RESIDUAL PROJECTION VECTORS", nVecsProject);
+    int nStepsStart = 5;
+    options.getArgs("RESIDUAL PROJECTION START", nStepsStart);
+    warmupSolves = nStepsStart + nVecsProject;
+  }
+
+  if (platform->comm.mpiRank == 0) {
+    printf("%s pMG autotuner: %d candidates, %d solves each after %d warmup solves\n",
+           elliptic->name.c_str(),
+           static_cast<int>(candidates.size()),
+           solvesPerCandidate,
+           warmupSolves);
+  }
+}
+
+MGAutotuner_t::~MGAutotuner_t()
+{
+  // the hierarchy in use is owned by elliptic
+  for (auto &&h : hierarchies) {
+    if (h.precon == elliptic->precon)
+      continue;
+    delete h.precon;
+    free(h.levelDegrees);
+  }
+}
+
+void MGAutotuner_t::tic()
+{
+  platform->device.finish();
+  MPI_Barrier(platform->comm.mpiComm);
+  tStart = MPI_Wtime();
+}
+
+void MGAutotuner_t::toc()
+{
+  platform->device.finish();
+  double elapsed = MPI_Wtime() - tStart;
+  MPI_Allreduce(MPI_IN_PLACE, &elapsed, 1, MPI_DOUBLE, MPI_MAX, platform->comm.mpiComm);
+
+  solves++;
+  if (solves <= warmupSolves)
+    return;
+
+  auto &c = candidates.at(current);
+  c.elapsed += elapsed;
+  c.Niter += elliptic->Niter;
+  if ((solves - warmupSolves) % solvesPerCandidate)
+    return;
+
+  if (platform->comm.mpiRank == 0) {
+    printf("%s pMG autotuner: candidate %d/%d %.3es (%d iterations)\n",
+           elliptic->name.c_str(),
+           current + 1,
+           static_cast<int>(candidates.size()),
+           c.elapsed / solvesPerCandidate,
+           c.Niter / solvesPerCandidate);
+  }
+
+  current++;
+  if (current < candidates.size())
+    apply(candidates.at(current));
+  else
+    finalize();
+}
+
+void MGAutotuner_t::apply(const candidate_t &c)
+{
+  setupAide &options = elliptic->options;
+
+  // determineMGLevels reads the schedule from the global options
+  options.setArgs("MULTIGRID SMOOTHER", c.smoother);
+  platform->options.setArgs(optionsPrefix + "MULTIGRID SMOOTHER", c.smoother);
+  if (c.schedule.empty()) {
+    options.removeArgs("MULTIGRID SCHEDULE");
+    platform->options.removeArgs(optionsPrefix + "MULTIGRID SCHEDULE");
+  } else {
+    options.setArgs("MULTIGRID SCHEDULE", c.schedule);
+    platform->options.setArgs(optionsPrefix + "MULTIGRID SCHEDULE", c.schedule);
+  }
+
+  if (platform->comm.mpiRank == 0) {
+    printf("%s pMG autotuner: smootherType = %s, pMGSchedule = %s\n",
+           elliptic->name.c_str(),
+           parSmootherType(c.smoother).c_str(),
+           c.schedule.empty() ? "default" : c.schedule.c_str());
+  }
+
+  auto h = std::find_if(hierarchies.begin(), hierarchies.end(), [&](const hierarchy_t &h) {
+    return h.levels == c.levels;
+  });
+
+  if (h == hierarchies.end()) {
+    ellipticPreconditionerSetup(elliptic, elliptic->ogs);
+    hierarchies.push_back({c.levels, elliptic->precon, elliptic->levels});
+    return;
+  }
+
+  elliptic->precon = h->precon;
+  elliptic->levels = h->levelDegrees;
+  elliptic->nLevels = h->levels.size();
+
+  // switch smoother and Chebyshev orders of the existing levels
+  MGSolver_t *MGSolver = elliptic->precon->MGSolver;
+  elliptic_t *ellipticBase = dynamic_cast<pMGLevel *>(MGSolver->levels[0])->elliptic;
+  for (int levelIndex = 0; levelIndex < MGSolver->numLevels; levelIndex++) {
+    auto level = dynamic_cast<pMGLevel *>(MGSolver->levels[levelIndex]);
+    level->options.setArgs("MULTIGRID SMOOTHER", c.smoother);
+    if (c.schedule.empty())
+      level->options.removeArgs("MULTIGRID SCHEDULE");
+    else
+      level->options.setArgs("MULTIGRID SCHEDULE", c.schedule);
+    level->setupSmoother(ellipticBase);
+  }
+}
+
+void MGAutotuner_t::finalize()
+{
+  auto best = std::min_element(candidates.begin(),
+                               candidates.end(),
+                               [](const candidate_t &a, const candidate_t &b) { return a.elapsed < b.elapsed; });
+
+  if (best != candidates.end() - 1)
+    apply(*best);
+
+  if (platform->comm.mpiRank == 0) {
+    printf("%s pMG autotuner selected candidate %d (%.3es, initial %.3es)\n",
+           elliptic->name.c_str(),
+           static_cast<int>(best - candidates.begin()) + 1,
+           best->elapsed / solvesPerCandidate,
+           candidates.front().elapsed / solvesPerCandidate);
+    printf("reuse by setting in [%s]:\n", elliptic->name.c_str());
+    printf("  smootherType = %s\n", parSmootherType(best->smoother).c_str());
+    if (!best->schedule.empty())
+      printf("  pMGSchedule = %s\n", best->schedule.c_str());
+  }
+
+  finished = true;
+}
+
+std::string MGAutotuner_t::parSmootherType(const std::string &smoother) const
+{
+  std::string s = "ASM";
+  if (smoother.find("DAMPEDJACOBI") != std::string::npos)
+    s = "Jacobi";
+  else if (smoother.find("RAS") != std::string::npos)
+    s = "RAS";
+
+  if (smoother.find("FOURTHOPTCHEBYSHEV") != std::string::npos)
+    s += "+FourthOptChebyshev";
+  else if (smoother.find("FOURTHCHEBYSHEV") != std::string::npos)
+    s += "+FourthChebyshev";
+  else if (smoother.find("CHEBYSHEV") != std::string::npos)
+    s += "+Chebyshev";
+
+  return s;
+}
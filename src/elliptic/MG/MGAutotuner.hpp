@@ -0,0 +1,61 @@
+#ifndef MGAUTOTUNER_HPP
+#define MGAUTOTUNER_HPP
+
+#include <string>
+#include <vector>
+
+class elliptic_t;
+class precon_t;
+
+// candidate pMG level sets (finest first) considered by the autotuner
+std::vector<std::vector<int>> MGAutotuneLevels(const std::string &section);
+
+// Runtime selection of the pMG schedule and smoother.
+// Every candidate is used for the next pressure solves, the wall time to
+// tolerance is measured and the fastest configuration is locked in.
+class MGAutotuner_t
+{
+public:
+  MGAutotuner_t(elliptic_t *elliptic);
+  ~MGAutotuner_t();
+
+  void tic();
+  void toc();
+
+  bool done() const { return finished; }
+
+private:
+  struct candidate_t {
+    std::string smoother;
+    std::string schedule;
+    std::vector<int> levels;
+    double elapsed = 0;
+    int Niter = 0;
+  };
+
+  // preconditioner built for one level set, reused across smoothers
+  struct hierarchy_t {
+    std::vector<int> levels;
+    precon_t *precon;
+    int *levelDegrees;
+  };
+
+  void apply(const candidate_t &c);
+  void finalize();
+  std::string parSmootherType(const std::string &smoother) const;
+
+  elliptic_t *elliptic;
+  std::string optionsPrefix;
+
+  std::vector<candidate_t> candidates;
+  std::vector<hierarchy_t> hierarchies;
+  int current = 0;
+  int solves = 0;
+  int warmupSolves = 1;
+  int solvesPerCandidate = 2;
+
+  double tStart = 0;
+  bool finished = false;
+};
+
+#endif
@@ -57,6 +57,49 @@ void prolongateV(MGSolver_t* M)
     levelC->prolongate(o_xC, o_x);
   }
 }
+bool enableOverlap(int rank, int size)
+{
+  bool overlap = false;
+  if(platform->device.mode() == "Serial" || platform->device.mode() == "OpenMP"){
+    overlap = false;
+  } else {
+    overlap = true;
+    int provided;
+    MPI_Query_thread(&provided);
+    if(provided != MPI_THREAD_MULTIPLE) {
+      overlap = false;
+      if(rank ==0 && size > 1) 
+        printf("disable overlapping coarse solve as MPI_THREAD_MULTIPLE is not supported!\n");
+    }
+    if(size == 1) overlap = true;
+  }
+  if(rank ==0 && overlap) printf("overlapping coarse grid solve enabled\n");
+  return overlap;
+}
+
+// host BoomerAMG solve of the E-vector Sx (in place)
+void coarseSolveHost(MGSolver_t* M)
+{
+  auto coarseLevel = M->coarseLevel;
+  auto ogs = coarseLevel->ogs;
+  auto Gx = coarseLevel->Gx;
+  auto Sx = coarseLevel->Sx;
+  auto xBuffer = coarseLevel->xBuffer;
+
+  for(int i = 0; i < ogs->N; i++)
+    Sx[i] *= coarseLevel->weight[i]; 
+  ogsGather(Gx, Sx, ogsPfloat, ogsAdd, ogs);
+
+  for(int i = 0; i < coarseLevel->N; i++) {
+    xBuffer[i] = 0; 
+  }
+
+  auto boomerAMG = (hypreWrapper::boomerAMG_t*) coarseLevel->boomerAMG;
+  boomerAMG->solve(Gx, xBuffer);
+
+  ogsScatter(Sx, xBuffer, ogsPfloat, ogsAdd, ogs);
+}
+
 void schwarzSolve(MGSolver_t* M)
 {    
   for(int k = 0 ; k < M->numLevels-1; ++k){
@@ -99,29 +142,17 @@ MGSolver_t::MGSolver_t(occa::device device_, MPI_Comm comm_,
   if(options.compareArgs("MGSOLVER CYCLE", "VCYCLE")) {
     ctype = VCYCLE;
     additive = false;
+    hybrid = false;
+    kcycle = false;
+    overlapCrsGridSolve = false;
     if(options.compareArgs("MGSOLVER CYCLE", "ADDITIVE")) {
       if (options.compareArgs("MGSOLVER SMOOTHER", "CHEBYSHEV")) {
         if(rank==0) printf("Additive vcycle is not supported for Chebyshev!\n");
         MPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
       }
       additive = true;
-      overlapCrsGridSolve = false;
-      if(options.compareArgs("MGSOLVER CYCLE", "OVERLAPCRS")){
-        if(platform->device.mode() == "Serial" || platform->device.mode() == "OpenMP"){
-          overlapCrsGridSolve = false;
-        } else {
-          overlapCrsGridSolve = true;
-          int provided;
-          MPI_Query_thread(&provided);
-          if(provided != MPI_THREAD_MULTIPLE) {
-            overlapCrsGridSolve = false;
-            if(rank ==0 && size > 1) 
-              printf("disable overlapping coarse solve as MPI_THREAD_MULTIPLE is not supported!\n");
-          }
-          if(size == 1) overlapCrsGridSolve = true;
-        }
-        if(rank ==0 && overlapCrsGridSolve) printf("overlapping coarse grid solve enabled\n");
-      }
+      if(options.compareArgs("MGSOLVER CYCLE", "OVERLAPCRS"))
+        overlapCrsGridSolve = enableOverlap(rank, size);
     } else {
       if (options.compareArgs("MGSOLVER SMOOTHER", "RAS") || 
           options.compareArgs("MGSOLVER SMOOTHER", "ASM")) {
@@ -131,6 +162,21 @@ MGSolver_t::MGSolver_t(occa::device device_, MPI_Comm comm_,
           MPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE); 
         }
       }
+      kcycle = options.compareArgs("MGSOLVER CYCLE", "KCYCLE");
+      if(options.compareArgs("MGSOLVER CYCLE", "OVERLAPCRS")) {
+        if(kcycle) {
+          if(rank==0) printf("Overlapping coarse grid solve is not supported for K-cycle!\n");
+          MPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE); 
+        }
+        nrsCheck(!options.compareArgs("COARSE SOLVER", "BOOMERAMG") ||
+                 options.compareArgs("COARSE SOLVER LOCATION", "DEVICE"),
+                 comm, EXIT_FAILURE,
+                 "%s\n", "Overlapping coarse grid solve requires BoomerAMG on the host!");
+        // the additive coarse grid correction only pays off if it runs concurrently
+        // to the device smoothing, otherwise stay with the multiplicative cycle
+        overlapCrsGridSolve = enableOverlap(rank, size);
+        hybrid = overlapCrsGridSolve;
+      }
     }
   } else {
     if(rank==0) printf("Unknown multigrid cycle type!\n");
@@ -145,6 +191,14 @@ MGSolver_t::~MGSolver_t() {
   free(levels);
 
   if(coarseLevel) delete coarseLevel; 
+
+  for(auto &work : kcycleWork) {
+    work.o_r.free();
+    work.o_c.free();
+    work.o_v.free();
+    work.o_w.free();
+  }
+  kcycleWork.clear();
 }
 
 void MGSolver_t::Run(occa::memory o_rhs, occa::memory o_x) 
@@ -155,6 +209,8 @@ void MGSolver_t::Run(occa::memory o_rhs, occa::memory o_x)
   if(ctype == VCYCLE) {
     if(additive)
       runAdditiveVcycle();
+    else if(hybrid && baseLevel > 0)
+      runHybridVcycle();
     else
       runVcycle(0);
   }
@@ -176,6 +232,13 @@ void MGSolver_t::runVcycle(int k)
     return;
   }
 
+  // coarse grid correction is added by runHybridVcycle
+  if(hybrid && k == baseLevel - 1) {
+    level->smooth(o_rhs, o_x, true);
+    level->smooth(o_rhs, o_x, false);
+    return;
+  }
+
   MGSolver_t::multigridLevel *levelC = levels[k+1];
   occa::memory o_rhsC = levelC->o_rhs;
   occa::memory o_xC   = levelC->o_x;
@@ -185,13 +248,68 @@ void MGSolver_t::runVcycle(int k)
 
   levelC->coarsen(o_res, o_rhsC);
 
-  this->runVcycle(k+1);
+  if(kcycle && k+1 < baseLevel)
+    this->runKcycle(k+1);
+  else
+    this->runVcycle(k+1);
 
   levelC->prolongate(o_xC, o_x);
 
   level->smooth(o_rhs, o_x, false);
 }
 
+void MGSolver_t::runKcycle(int k)
+{
+  // approximate A_k x = rhs by two steps of flexible CG (Notay & Vassilevski)
+  MGSolver_t::multigridLevel *level = levels[k];
+  const dlong N = level->Nrows;
+  const size_t Nbytes = level->Ncols * sizeof(pfloat);
+
+  if(kcycleWork.size() < numLevels) kcycleWork.resize(numLevels);
+  auto &work = kcycleWork[k];
+  if(work.o_c.size() < Nbytes) {
+    work.o_r = platform->device.malloc(Nbytes);
+    work.o_c = platform->device.malloc(Nbytes);
+    work.o_v = platform->device.malloc(Nbytes);
+    work.o_w = platform->device.malloc(Nbytes);
+  }
+
+  occa::memory o_rhs = level->o_rhs;
+  occa::memory o_x   = level->o_x;
+
+  // c = B rhs, v = A c
+  this->runVcycle(k);
+  work.o_c.copyFrom(o_x, Nbytes);
+  level->Ax(work.o_c, work.o_v);
+
+  const dfloat rho1   = level->innerProduct(work.o_c, work.o_v);
+  const dfloat alpha1 = level->innerProduct(work.o_c, o_rhs);
+
+  if(rho1 <= 0) return;
+
+  // r = rhs - alpha1/rho1 v, d = B r, w = A d
+  work.o_r.copyFrom(o_rhs, Nbytes);
+  platform->linAlg->paxpby(N, -alpha1/rho1, work.o_v, 1.0, work.o_r);
+
+  level->o_rhs = work.o_r;
+  this->runVcycle(k);
+  level->o_rhs = o_rhs;
+  level->Ax(o_x, work.o_w);
+
+  const dfloat gamma  = level->innerProduct(o_x, work.o_v);
+  const dfloat beta   = level->innerProduct(o_x, work.o_w);
+  const dfloat alpha2 = level->innerProduct(o_x, work.o_r);
+  const dfloat rho2   = beta - gamma*gamma/rho1;
+
+  if(rho2 <= 0) {
+    platform->linAlg->paxpby(N, alpha1/rho1, work.o_c, 0.0, o_x);
+    return;
+  }
+
+  // x = (alpha1/rho1 - gamma*alpha2/(rho1*rho2)) c + alpha2/rho2 d
+  platform->linAlg->paxpby(N, alpha1/rho1 - gamma*alpha2/(rho1*rho2), work.o_c, alpha2/rho2, o_x);
+}
+
 void MGSolver_t::runAdditiveVcycle()
 {
   {
@@ -202,17 +320,9 @@ void MGSolver_t::runAdditiveVcycle()
   occa::memory o_rhs = levels[baseLevel]->o_rhs;
   occa::memory o_x   = levels[baseLevel]->o_x;
 
-  auto xBuffer = this->coarseLevel->xBuffer;
-  auto ogs = this->coarseLevel->ogs;
-
-  auto Gx = this->coarseLevel->Gx;
-  auto Sx = this->coarseLevel->Sx;
-
   // local E vector size
-  const auto Nlocal = ogs->N;
-
-  // local T vector size
-  const auto NlocalT = this->coarseLevel->N;
+  const auto Nlocal = this->coarseLevel->ogs->N;
+  auto Sx = this->coarseLevel->Sx;
 
   o_rhs.copyTo(Sx, Nlocal*sizeof(pfloat));
 
@@ -227,24 +337,58 @@ void MGSolver_t::runAdditiveVcycle()
       }
       #pragma omp task
       {
-        for(int i = 0; i < Nlocal; i++)
-          Sx[i] *= this->coarseLevel->weight[i]; 
-        ogsGather(Gx, Sx, ogsPfloat, ogsAdd, ogs);
-    
-        for(int i = 0; i < NlocalT; i++) {
-          xBuffer[i] = 0; 
-        }
- 
-        auto boomerAMG = (hypreWrapper::boomerAMG_t*) coarseLevel->boomerAMG;
-        boomerAMG->solve(Gx, xBuffer);
+        coarseSolveHost(this);
+      }
+    }
+  }
+
+  o_x.copyFrom(Sx, Nlocal*sizeof(pfloat));
+
+  {
+    prolongateV(this);
+  }
+}
+
+void MGSolver_t::runHybridVcycle()
+{
+  // restrict rhs to the coarsest level
+  {
+    coarsenV(this);
+  }
 
-        ogsScatter(Sx, xBuffer, ogsPfloat, ogsAdd, ogs);
+  const int nThreads = this->overlapCrsGridSolve ? 2 : 1;
+  occa::memory o_rhs = levels[baseLevel]->o_rhs;
+  occa::memory o_x   = levels[baseLevel]->o_x;
+
+  // local E vector size
+  const auto Nlocal = this->coarseLevel->ogs->N;
+  auto Sx = this->coarseLevel->Sx;
+
+  o_rhs.copyTo(Sx, Nlocal*sizeof(pfloat));
+
+  // coarse solve runs on the host while the fine levels are smoothed
+  o_x.getDevice().finish();
+  #pragma omp parallel proc_bind(close) num_threads(nThreads)
+  {
+    #pragma omp single
+    {
+      #pragma omp task
+      {
+        this->runVcycle(0);
+      }
+      #pragma omp task
+      {
+        coarseSolveHost(this);
       }
     }
   }
 
   o_x.copyFrom(Sx, Nlocal*sizeof(pfloat));
 
+  // intermediate corrections were already added to the finest level
+  for(int k = 1; k < baseLevel; ++k)
+    platform->linAlg->pfill(levels[k]->Ncols, 0.0, levels[k]->o_x);
+
   {
     prolongateV(this);
   }
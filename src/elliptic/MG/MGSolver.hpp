@@ -28,6 +28,7 @@ SOFTWARE.
 #define MGSOLVER_HPP
 
 #include <functional>
+#include <vector>
 
 #include "nrssys.hpp"
 #include "defines.hpp"
@@ -65,6 +66,8 @@ public:
     virtual void coarsen(occa::memory o_x, occa::memory o_Cx)=0;
   
     virtual void prolongate(occa::memory o_x, occa::memory o_Px)=0;
+
+    virtual dfloat innerProduct(occa::memory o_x, occa::memory o_y)=0;
   
     virtual void Report()=0;
   };
@@ -122,6 +125,13 @@ public:
   bool additive;
   bool overlapCrsGridSolve;
 
+  // multiplicative smoothing on the fine levels plus an additive coarse grid
+  // correction computed from the restricted rhs (can be overlapped)
+  bool hybrid;
+
+  // two flexible CG iterations preconditioned by the V-cycle on coarse levels
+  bool kcycle;
+
   MGSolver_t(occa::device otherdevice, MPI_Comm othercomm,
            setupAide otheroptions);
 
@@ -133,8 +143,15 @@ public:
 
 
 private:
+  struct kcycleWork_t {
+    occa::memory o_r, o_c, o_v, o_w;
+  };
+  std::vector<kcycleWork_t> kcycleWork;
+
   void runVcycle(int k);
+  void runKcycle(int k);
   void runAdditiveVcycle();
+  void runHybridVcycle();
 
 
 };
@@ -52,9 +52,20 @@ elliptic_t* ellipticBuildMultigridLevel(elliptic_t* baseElliptic, int Nc, int Nf
 
   elliptic->mgLevel = true;
 
-  mesh_t* mesh = createMeshMG(baseElliptic->mesh, Nc);
+  const bool pfloatGeom = elliptic->options.compareArgs("MULTIGRID GEOMETRY PRECISION", "FP32") &&
+                          !strstr(pfloatString, dfloatString);
+  mesh_t* mesh = createMeshMG(baseElliptic->mesh, Nc, pfloatGeom);
   elliptic->mesh = mesh;
 
+  if (pfloatGeom) {
+    double savedBytes = (static_cast<double>(mesh->Nelements) * mesh->Np * mesh->Nggeo +
+                         2.0 * mesh->Nq * mesh->Nq) * sizeof(dfloat);
+    MPI_Allreduce(MPI_IN_PLACE, &savedBytes, 1, MPI_DOUBLE, MPI_MAX, platform->comm.mpiComm);
+    if (platform->comm.mpiRank == 0)
+      printf("geometric factors stored in %s only, saved %.2f MB device memory per rank\n",
+             pfloatString, savedBytes / 1e6);
+  }
+
   elliptic->fieldOffset = mesh->Nlocal; // assumes elliptic->Nfields == 1
 
   { // setup an unmasked gs handle
@@ -141,10 +152,10 @@ elliptic_t* ellipticBuildMultigridLevel(elliptic_t* baseElliptic, int Nc, int Nf
   elliptic->o_interp = platform->device.malloc(Nfq * Ncq * sizeof(pfloat));
   platform->copyDfloatToPfloatKernel(Nfq * Ncq, o_interp, elliptic->o_interp);
 
-  precon->coarsenKernel(mesh->Nelements, elliptic->o_interp, 
+  precon->coarsenKernel(mesh->Nelements, mesh->o_elementList, elliptic->o_interp, 
                         baseElliptic->o_lambda0, elliptic->o_lambda0);
   if(!baseElliptic->poisson)
-    precon->coarsenKernel(mesh->Nelements, elliptic->o_interp, 
+    precon->coarsenKernel(mesh->Nelements, mesh->o_elementList, elliptic->o_interp, 
                           baseElliptic->o_lambda1, elliptic->o_lambda1);
 
   free(fToCInterp);
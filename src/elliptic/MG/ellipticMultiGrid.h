@@ -95,6 +95,13 @@ public:
   // Eigenvalues
   occa::memory o_invL;
 
+  // element lengths the FDM operators were built for (moving mesh only)
+  std::vector<dfloat> FDMLengths;
+  int FDMUpdateCounter = 0;
+
+  // dfloat copies for inner products
+  occa::memory o_invDegreeDfloat, o_xDfloat, o_yDfloat;
+
   //jacobi data
   occa::memory o_invDiagA;
 
@@ -145,6 +152,8 @@ public:
   void prolongate(dfloat* /*x*/, dfloat* /*Px*/) {}
   void prolongate(occa::memory o_x, occa::memory o_Px) final;
 
+  dfloat innerProduct(occa::memory o_x, occa::memory o_y) final;
+
   //smoother ops
   void smooth(dfloat* /*rhs*/, dfloat* /*x*/, bool /*x_is_zero*/) {}
   void smooth(occa::memory o_rhs, occa::memory o_x, bool x_is_zero) final;
@@ -53,13 +53,37 @@ void pMGLevel::coarsen(occa::memory o_x, occa::memory o_Rx)
 
   precon_t *precon = elliptic->precon;
 
-  precon->coarsenKernel(mesh->Nelements, o_R, o_x, o_Rx);
   const auto workPerElem = 2 * (NqF * NqF * NqF * NqC + NqF * NqF * NqC * NqC + NqF * NqC * NqC * NqC);
   flopCounter += static_cast<double>(mesh->Nelements) * workPerElem;
 
-  if (options.compareArgs("DISCRETIZATION","CONTINUOUS")) {
-    oogs::startFinish(o_Rx, elliptic->Nfields, elliptic->fieldOffset, ogsPfloat, ogsAdd, elliptic->oogs);
+  mesh_t *meshC = elliptic->mesh;
+  oogs_t *oogs = elliptic->oogsAx;
+  const bool overlap = (oogs != elliptic->oogs);
+
+  if (options.compareArgs("DISCRETIZATION","CONTINUOUS") && overlap) {
+    const std::string tag = "pMGLevel::coarsen N=" + std::to_string(meshC->N);
+
+    if (meshC->NglobalGatherElements)
+      precon->coarsenKernel(meshC->NglobalGatherElements, meshC->o_globalGatherElementList, o_R, o_x, o_Rx);
+
+    oogs::start(o_Rx, elliptic->Nfields, elliptic->fieldOffset, ogsPfloat, ogsAdd, oogs);
+    platform->timer.gsOverlapBegin(tag);
+
+    if (meshC->NlocalGatherElements)
+      precon->coarsenKernel(meshC->NlocalGatherElements, meshC->o_localGatherElementList, o_R, o_x, o_Rx);
+
+    platform->timer.gsOverlapWait(tag);
+    oogs::finish(o_Rx, elliptic->Nfields, elliptic->fieldOffset, ogsPfloat, ogsAdd, oogs);
+    platform->timer.gsOverlapEnd(tag);
+
     ellipticApplyMask(elliptic, o_Rx, pfloatString); // apply mask again because coarsenKernel do not preserve it
+  } else {
+    precon->coarsenKernel(mesh->Nelements, meshC->o_elementList, o_R, o_x, o_Rx);
+
+    if (options.compareArgs("DISCRETIZATION","CONTINUOUS")) {
+      oogs::startFinish(o_Rx, elliptic->Nfields, elliptic->fieldOffset, ogsPfloat, ogsAdd, elliptic->oogs);
+      ellipticApplyMask(elliptic, o_Rx, pfloatString); // apply mask again because coarsenKernel do not preserve it
+    }
   }
 
   const double factor = std::is_same<pfloat, float>::value ? 0.5 : 1.0;
@@ -82,6 +106,26 @@ void pMGLevel::prolongate(occa::memory o_x, occa::memory o_Px)
   platform->flopCounter->add("pMGLevel::prolongate, N=" + std::to_string(mesh->N), factor * flopCounter);
 }
 
+dfloat pMGLevel::innerProduct(occa::memory o_x, occa::memory o_y)
+{
+  if(o_xDfloat.size() == 0) {
+    o_invDegreeDfloat = platform->device.malloc(Nrows * sizeof(dfloat), elliptic->ogs->invDegree);
+    o_xDfloat = platform->device.malloc(Ncols * sizeof(dfloat));
+    o_yDfloat = platform->device.malloc(Ncols * sizeof(dfloat));
+  }
+
+  platform->copyPfloatToDfloatKernel(Nrows, o_x, o_xDfloat);
+  platform->copyPfloatToDfloatKernel(Nrows, o_y, o_yDfloat);
+
+  return platform->linAlg->weightedInnerProdMany(Nrows,
+                                                 elliptic->Nfields,
+                                                 elliptic->fieldOffset,
+                                                 o_invDegreeDfloat,
+                                                 o_xDfloat,
+                                                 o_yDfloat,
+                                                 platform->comm.mpiComm);
+}
+
 void pMGLevel::smooth(occa::memory o_rhs, occa::memory o_x, bool x_is_zero)
 {
   platform->timer.tic(elliptic->name + " preconditioner smoother N=" + std::to_string(mesh->N), 1);
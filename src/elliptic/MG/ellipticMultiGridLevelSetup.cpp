@@ -110,14 +110,20 @@ void pMGLevel::setupSmoother(elliptic_t* ellipticBase)
   const bool useASM = options.compareArgs("MULTIGRID SMOOTHER","ASM");
   const bool useRAS = options.compareArgs("MULTIGRID SMOOTHER","RAS");
   const bool useJacobi = options.compareArgs("MULTIGRID SMOOTHER","DAMPEDJACOBI");
+
+  // may be called again on an existing level to switch the smoother,
+  // the smoother operators are only built on first use
+  chebySmootherType = ChebyshevSmootherType::NONE;
   if (useASM || useRAS){
     smootherType = useASM ? SmootherType::ASM : SmootherType::RAS;
-    build(ellipticBase);
+    if (!o_Sx.isInitialized())
+      build(ellipticBase);
   } else {
     nrsCheck(!useJacobi, platform->comm.mpiComm, EXIT_FAILURE,
              "Invalid pMGLevel smoother!\n", "");
     smootherType = SmootherType::JACOBI;
-    o_invDiagA = platform->device.malloc(mesh->Nlocal * sizeof(pfloat));
+    if (!o_invDiagA.isInitialized())
+      o_invDiagA = platform->device.malloc(mesh->Nlocal * sizeof(pfloat));
     ellipticUpdateJacobi(elliptic, o_invDiagA); // required to compute eigenvalues 
   }
 
@@ -27,6 +27,7 @@
 #include <type_traits>
 #include "elliptic.h"
 #include "ellipticMultiGrid.h"
+#include "ellipticPrecon.h"
 #include <vector>
 #include <algorithm>
 #include <math.h>
@@ -35,6 +36,8 @@
 #include <sstream>
 #include <exception>
 #include <array>
+#include <map>
+#include <tuple>
 
 #include "platform.hpp"
 
@@ -49,13 +52,11 @@ struct ElementLengths {
   dfloat *length_right_y;
   dfloat *length_right_z;
 };
-struct FDMOperators {
-  dfloat *Sx;
-  dfloat *Sy;
-  dfloat *Sz;
-  dfloat *D;
-};
-void harmonic_mean_element_length(ElementLengths *lengths, elliptic_t *elliptic)
+void harmonic_mean_element_length(ElementLengths *lengths,
+                                  elliptic_t *elliptic,
+                                  const dfloat *x,
+                                  const dfloat *y,
+                                  const dfloat *z)
 {
   mesh_t *mesh = elliptic->mesh;
   const dlong Nelements = mesh->Nelements;
@@ -83,9 +84,9 @@ void harmonic_mean_element_length(ElementLengths *lengths, elliptic_t *elliptic)
         const dlong i2jk = i2 + j * Nq + k * Nq * Nq + elem_offset;
         const dlong i1jk = i1 + j * Nq + k * Nq * Nq + elem_offset;
         const double weight = (Nq == 2) ? 1.0 : w[j - 1] * w[k - 1];
-        const double dist_x = mesh->x[i2jk] - mesh->x[i1jk];
-        const double dist_y = mesh->y[i2jk] - mesh->y[i1jk];
-        const double dist_z = mesh->z[i2jk] - mesh->z[i1jk];
+        const double dist_x = x[i2jk] - x[i1jk];
+        const double dist_y = y[i2jk] - y[i1jk];
+        const double dist_z = z[i2jk] - z[i1jk];
         const double denom = dist_x * dist_x + dist_y * dist_y + dist_z * dist_z;
         lr2 += weight / denom;
         wsum += weight;
@@ -101,9 +102,9 @@ void harmonic_mean_element_length(ElementLengths *lengths, elliptic_t *elliptic)
         const dlong ij2k = i + j2 * Nq + k * Nq * Nq + elem_offset;
         const dlong ij1k = i + j1 * Nq + k * Nq * Nq + elem_offset;
         const double weight = (Nq == 2) ? 1.0 : w[i - 1] * w[k - 1];
-        const double dist_x = mesh->x[ij2k] - mesh->x[ij1k];
-        const double dist_y = mesh->y[ij2k] - mesh->y[ij1k];
-        const double dist_z = mesh->z[ij2k] - mesh->z[ij1k];
+        const double dist_x = x[ij2k] - x[ij1k];
+        const double dist_y = y[ij2k] - y[ij1k];
+        const double dist_z = z[ij2k] - z[ij1k];
         const double denom = dist_x * dist_x + dist_y * dist_y + dist_z * dist_z;
         ls2 += weight / denom;
         wsum += weight;
@@ -119,9 +120,9 @@ void harmonic_mean_element_length(ElementLengths *lengths, elliptic_t *elliptic)
         const dlong ijk2 = i + j * Nq + k2 * Nq * Nq + elem_offset;
         const dlong ijk1 = i + j * Nq + k1 * Nq * Nq + elem_offset;
         const double weight = (Nq == 2) ? 1.0 : w[i - 1] * w[j - 1];
-        const double dist_x = mesh->x[ijk2] - mesh->x[ijk1];
-        const double dist_y = mesh->y[ijk2] - mesh->y[ijk1];
-        const double dist_z = mesh->z[ijk2] - mesh->z[ijk1];
+        const double dist_x = x[ijk2] - x[ijk1];
+        const double dist_y = y[ijk2] - y[ijk1];
+        const double dist_z = z[ijk2] - z[ijk1];
         const double denom = dist_x * dist_x + dist_y * dist_y + dist_z * dist_z;
         lt2 += weight / denom;
         wsum += weight;
@@ -131,7 +132,11 @@ void harmonic_mean_element_length(ElementLengths *lengths, elliptic_t *elliptic)
   }
 }
 
-void compute_element_lengths(ElementLengths *lengths, elliptic_t *elliptic)
+void compute_element_lengths(ElementLengths *lengths,
+                             elliptic_t *elliptic,
+                             const dfloat *x,
+                             const dfloat *y,
+                             const dfloat *z)
 {
   mesh_t *mesh = elliptic->mesh;
   const dlong Nelements = elliptic->mesh->Nelements;
@@ -150,7 +155,7 @@ void compute_element_lengths(ElementLengths *lengths, elliptic_t *elliptic)
   const int N = mesh->N;
   const int Nq = mesh->Nq;
 
-  harmonic_mean_element_length(lengths, elliptic);
+  harmonic_mean_element_length(lengths, elliptic, x, y, z);
 
   // add check for small values in middle elements
   const double tol = 1e-12;
@@ -278,6 +283,35 @@ void compute_element_lengths(ElementLengths *lengths, elliptic_t *elliptic)
   free(l);
 }
 
+std::array<dfloat *, 9> element_length_arrays(ElementLengths *lengths)
+{
+  return {lengths->length_left_x,
+          lengths->length_left_y,
+          lengths->length_left_z,
+          lengths->length_middle_x,
+          lengths->length_middle_y,
+          lengths->length_middle_z,
+          lengths->length_right_x,
+          lengths->length_right_y,
+          lengths->length_right_z};
+}
+
+std::vector<dfloat> pack_element_lengths(ElementLengths *lengths, const dlong Nelements)
+{
+  std::vector<dfloat> packed;
+  packed.reserve(9 * Nelements);
+  for (auto &&l : element_length_arrays(lengths))
+    packed.insert(packed.end(), l, l + Nelements);
+  return packed;
+}
+
+void free_element_lengths(ElementLengths *lengths)
+{
+  for (auto &&l : element_length_arrays(lengths))
+    free(l);
+  free(lengths);
+}
+
 void compute_element_boundary_conditions(int *lbr,
                                          int *rbr,
                                          int *lbs,
@@ -308,36 +342,35 @@ void row_zero(dfloat *S, const int nl, const int offset)
     S[offset + nl * i] = 0.0;
 }
 
-void compute_1d_stiffness_matrix(dfloat *a,
-                                 const int lbc,
-                                 const int rbc,
-                                 const double ll,
-                                 const double lm,
-                                 const double lr,
-                                 const dlong e,
-                                 elliptic_t *elliptic)
+// Ah = D^T B D on the reference element, shared by all elements
+std::vector<dfloat> compute_1d_reference_stiffness_matrix(mesh_t *mesh)
 {
-  /** build ahat matrix here **/
-  // Ah = D^T B D
-
-  const int n = elliptic->mesh->N;
-  const int nl = n + 3;
-  dfloat *ah = (dfloat *)calloc((n + 1) * (n + 1), sizeof(dfloat));
-  dfloat *tmp = (dfloat *)calloc((n + 1) * (n + 1), sizeof(dfloat));
-  for (int i = 0; i < n + 1; ++i)
-    for (int j = 0; j < n + 1; ++j)
-      tmp[i * (n + 1) + j] = elliptic->mesh->D[i * (n + 1) + j];
+  const int n = mesh->N;
+  std::vector<dfloat> ah((n + 1) * (n + 1));
+  std::vector<dfloat> tmp((n + 1) * (n + 1));
   for (int i = 0; i < n + 1; ++i)
     for (int j = 0; j < n + 1; ++j)
-      tmp[i * (n + 1) + j] *= elliptic->mesh->gllw[i];
-  // A = D^T B D
+      tmp[i * (n + 1) + j] = mesh->D[i * (n + 1) + j] * mesh->gllw[i];
   for (int i = 0; i < n + 1; ++i)
     for (int j = 0; j < n + 1; ++j) {
       double aij = 0.0;
       for (int k = 0; k < n + 1; ++k)
-        aij += elliptic->mesh->D[k * (n + 1) + i] * tmp[k * (n + 1) + j];
+        aij += mesh->D[k * (n + 1) + i] * tmp[k * (n + 1) + j];
       ah[i + j * (n + 1)] = aij;
     }
+  return ah;
+}
+
+void compute_1d_stiffness_matrix(dfloat *a,
+                                 const dfloat *ah,
+                                 const int lbc,
+                                 const int rbc,
+                                 const double ll,
+                                 const double lm,
+                                 const double lr,
+                                 const int n)
+{
+  const int nl = n + 3;
 
 #define ah(i, j) ah[(i) + (n + 1) * (j)]
 #define a(id1, id2) a[(id1) + nl * (id2)]
@@ -378,22 +411,19 @@ void compute_1d_stiffness_matrix(dfloat *a,
   }
 #undef a
 #undef ah
-  free(ah);
-  free(tmp);
 }
 
 void compute_1d_mass_matrix(dfloat *b,
+                            const dfloat *bh,
                             const int lbc,
                             const int rbc,
                             const double ll,
                             const double lm,
                             const double lr,
-                            const dlong e,
-                            elliptic_t *elliptic)
+                            const int n)
 {
-  const int n = elliptic->mesh->Nq - 1;
   const int nl = n + 3;
-#define bh(i) elliptic->mesh->gllw[i]
+#define bh(i) bh[i]
 #define b(id1, id2) b[(id1) + nl * (id2)]
   int i0 = 0;
   if (lbc == 1)
@@ -427,6 +457,7 @@ void compute_1d_mass_matrix(dfloat *b,
     b(n + 2, n + 2) = 1.0;
   }
 #undef b
+#undef bh
 }
 
 extern "C" {
@@ -521,33 +552,15 @@ void compute_1d_matrices(dfloat *S,
                          const double ll,
                          const double lm,
                          const double lr,
-                         const dlong e,
-                         elliptic_t *elliptic,
-                         std::string direction,
-                         const int nl)
+                         const dfloat *ah,
+                         mesh_t *mesh)
 {
-  dfloat *b = (dfloat *)calloc(nl * nl, sizeof(dfloat));
-  compute_1d_stiffness_matrix(S, lbc, rbc, ll, lm, lr, e, elliptic);
-  compute_1d_mass_matrix(b, lbc, rbc, ll, lm, lr, e, elliptic);
-  try {
-    solve_generalized_ev(S, b, lam, nl);
-  }
-  catch (std::exception &failure) {
-    auto errTxt = [&]()
-    {
-      std::stringstream txt;
-      txt << "Encountered error:\n";
-      txt << failure.what();
-      txt << "Direction " << direction << "\n";
-      txt << "e = " << e << "\n";
-      txt << "lbc = " << lbc << ", rbc = " << rbc << "\n";
-      for (int iface = 0; iface < 6; ++iface)
-        txt << "EToB[iface] = " << elliptic->EToB[6 * e + iface] << "\n";
-
-      return txt.str();
-    };
-    nrsAbort(MPI_COMM_SELF, EXIT_FAILURE, errTxt().c_str(), "");
-  }
+  const int n = mesh->N;
+  const int nl = n + 3;
+  std::vector<dfloat> b(nl * nl);
+  compute_1d_stiffness_matrix(S, ah, lbc, rbc, ll, lm, lr, n);
+  compute_1d_mass_matrix(b.data(), mesh->gllw, lbc, rbc, ll, lm, lr, n);
+  solve_generalized_ev(S, b.data(), lam, nl);
   if (lbc > 0)
     row_zero(S, nl, 0);
   if (lbc == 1)
@@ -556,92 +569,118 @@ void compute_1d_matrices(dfloat *S,
     row_zero(S, nl, nl - 1);
   if (rbc == 1)
     row_zero(S, nl, nl - 2);
-  free(b);
 }
 
-void gen_operators(FDMOperators *op, ElementLengths *lengths, elliptic_t *elliptic)
+// Build the FDM operators (transposed 1D eigenvectors and inverse eigenvalue
+// sums) of the listed elements. Elements with the same boundary conditions and
+// lengths in a direction share the 1D eigenproblem, so only the distinct ones
+// are solved (in parallel) before they are scattered to the elements.
+void gen_operators(pfloat *Sx,
+                   pfloat *Sy,
+                   pfloat *Sz,
+                   pfloat *invL,
+                   ElementLengths *lengths,
+                   elliptic_t *elliptic,
+                   const std::vector<dlong> &elementList)
 {
-  const int Nq_e = elliptic->mesh->Nq + 2;
+  mesh_t *mesh = elliptic->mesh;
+  const int Nq_e = mesh->Nq + 2;
   const int Np_e = Nq_e * Nq_e * Nq_e;
-  const dlong Nelements = elliptic->mesh->Nelements;
-  op->Sx = (dfloat *)calloc(Nq_e * Nq_e * Nelements, sizeof(dfloat));
-  op->Sy = (dfloat *)calloc(Nq_e * Nq_e * Nelements, sizeof(dfloat));
-  op->Sz = (dfloat *)calloc(Nq_e * Nq_e * Nelements, sizeof(dfloat));
-  op->D = (dfloat *)calloc(Np_e * Nelements, sizeof(dfloat));
-
-#define df(a, b) (op->D[((a) + (b)*Np_e)])
+  const dlong Nelements = elementList.size();
   const double eps = 1e-5;
-  dfloat *lr = (dfloat *)calloc(Nq_e, sizeof(dfloat));
-  dfloat *ls = (dfloat *)calloc(Nq_e, sizeof(dfloat));
-  dfloat *lt = (dfloat *)calloc(Nq_e, sizeof(dfloat));
-  dfloat *Sx = (dfloat *)calloc(Nq_e * Nq_e, sizeof(dfloat));
-  dfloat *Sy = (dfloat *)calloc(Nq_e * Nq_e, sizeof(dfloat));
-  dfloat *Sz = (dfloat *)calloc(Nq_e * Nq_e, sizeof(dfloat));
-  for (dlong e = 0; e < Nelements; ++e) {
-    int lbr = -1, rbr = -1, lbs = -1, rbs = -1, lbt = -1, rbt = -1;
-    compute_element_boundary_conditions(&lbr, &rbr, &lbs, &rbs, &lbt, &rbt, e, elliptic);
-    compute_1d_matrices(Sx,
-                        lr,
-                        lbr,
-                        rbr,
-                        lengths->length_left_x[e],
-                        lengths->length_middle_x[e],
-                        lengths->length_right_x[e],
-                        e,
-                        elliptic,
-                        "r",
-                        Nq_e);
-    compute_1d_matrices(Sy,
-                        ls,
-                        lbs,
-                        rbs,
-                        lengths->length_left_y[e],
-                        lengths->length_middle_y[e],
-                        lengths->length_right_y[e],
-                        e,
-                        elliptic,
-                        "s",
-                        Nq_e);
-    compute_1d_matrices(Sz,
-                        lt,
-                        lbt,
-                        rbt,
-                        lengths->length_left_z[e],
-                        lengths->length_middle_z[e],
-                        lengths->length_right_z[e],
-                        e,
-                        elliptic,
-                        "t",
-                        Nq_e);
+  const char *directions[] = {"r", "s", "t"};
+
+  using problemKey = std::tuple<int, int, dfloat, dfloat, dfloat>;
+  std::map<problemKey, dlong> problemIds;
+  std::vector<problemKey> problems;
+  std::vector<std::pair<dlong, int>> problemOrigin;
+  std::vector<dlong> elementProblem(3 * Nelements);
+
+  for (dlong n = 0; n < Nelements; ++n) {
+    const dlong e = elementList[n];
+    int bc[6];
+    compute_element_boundary_conditions(&bc[0], &bc[1], &bc[2], &bc[3], &bc[4], &bc[5], e, elliptic);
+    const dfloat ll[3] = {lengths->length_left_x[e], lengths->length_left_y[e], lengths->length_left_z[e]};
+    const dfloat lm[3] = {lengths->length_middle_x[e],
+                          lengths->length_middle_y[e],
+                          lengths->length_middle_z[e]};
+    const dfloat lr[3] = {lengths->length_right_x[e], lengths->length_right_y[e], lengths->length_right_z[e]};
+    for (int dir = 0; dir < 3; ++dir) {
+      const problemKey key{bc[2 * dir], bc[2 * dir + 1], ll[dir], lm[dir], lr[dir]};
+      auto [entry, inserted] = problemIds.emplace(key, problems.size());
+      if (inserted) {
+        problems.push_back(key);
+        problemOrigin.push_back({e, dir});
+      }
+      elementProblem[3 * n + dir] = entry->second;
+    }
+  }
+
+  const auto ah = compute_1d_reference_stiffness_matrix(mesh);
+  const dlong Nproblems = problems.size();
+  std::vector<dfloat> S(Nproblems * Nq_e * Nq_e);
+  std::vector<dfloat> lam(Nproblems * Nq_e);
+
+#pragma omp parallel for
+  for (dlong p = 0; p < Nproblems; ++p) {
+    const int lbc = std::get<0>(problems[p]);
+    const int rbc = std::get<1>(problems[p]);
+    const dfloat ll = std::get<2>(problems[p]);
+    const dfloat lm = std::get<3>(problems[p]);
+    const dfloat lr = std::get<4>(problems[p]);
+    try {
+      compute_1d_matrices(&S[p * Nq_e * Nq_e], &lam[p * Nq_e], lbc, rbc, ll, lm, lr, ah.data(), mesh);
+    }
+    catch (std::exception &failure) {
+      const dlong e = problemOrigin[p].first;
+      const int dir = problemOrigin[p].second;
+      auto errTxt = [&]()
+      {
+        std::stringstream txt;
+        txt << "Encountered error:\n";
+        txt << failure.what();
+        txt << "Direction " << directions[dir] << "\n";
+        txt << "e = " << e << "\n";
+        txt << "lbc = " << lbc << ", rbc = " << rbc << "\n";
+        for (int iface = 0; iface < 6; ++iface)
+          txt << "EToB[iface] = " << elliptic->EToB[6 * e + iface] << "\n";
+
+        return txt.str();
+      };
+      nrsAbort(MPI_COMM_SELF, EXIT_FAILURE, errTxt().c_str(), "");
+    }
+  }
+
+#pragma omp parallel for
+  for (dlong n = 0; n < Nelements; ++n) {
+    const dlong e = elementList[n];
+    const dfloat *Sr = &S[elementProblem[3 * n + 0] * Nq_e * Nq_e];
+    const dfloat *Ss = &S[elementProblem[3 * n + 1] * Nq_e * Nq_e];
+    const dfloat *St = &S[elementProblem[3 * n + 2] * Nq_e * Nq_e];
+    const dfloat *lr = &lam[elementProblem[3 * n + 0] * Nq_e];
+    const dfloat *ls = &lam[elementProblem[3 * n + 1] * Nq_e];
+    const dfloat *lt = &lam[elementProblem[3 * n + 2] * Nq_e];
+
     // store the transposes
+    const dlong elem_offset = static_cast<dlong>(Nq_e) * Nq_e * e;
     for (int i = 0; i < Nq_e; ++i)
       for (int j = 0; j < Nq_e; ++j) {
-        const int elem_offset = Nq_e * Nq_e * e;
         const int ij = i + j * Nq_e;
         const int ji = j + i * Nq_e;
-        op->Sx[elem_offset + ij] = Sx[ji];
-        op->Sy[elem_offset + ij] = Sy[ji];
-        op->Sz[elem_offset + ij] = Sz[ji];
+        Sx[elem_offset + ij] = static_cast<pfloat>(Sr[ji]);
+        Sy[elem_offset + ij] = static_cast<pfloat>(Ss[ji]);
+        Sz[elem_offset + ij] = static_cast<pfloat>(St[ji]);
       }
-    unsigned l = 0;
+
+    dlong l = static_cast<dlong>(Np_e) * e;
     for (int k = 0; k < Nq_e; ++k)
       for (int j = 0; j < Nq_e; ++j)
         for (int i = 0; i < Nq_e; ++i) {
           const double diag = lr[i] + ls[j] + lt[k];
-          if (diag > eps)
-            df(l, e) = 1.0 / diag;
-          else
-            df(l, e) = 0.0;
+          invL[l] = (diag > eps) ? static_cast<pfloat>(1.0 / diag) : 0.0;
           l += 1;
         }
   }
-#undef df
-  free(lr);
-  free(ls);
-  free(lt);
-  free(Sx);
-  free(Sy);
-  free(Sz);
 }
 
 mesh_t *create_extended_mesh(elliptic_t *elliptic, hlong *maskedGlobalIds)
@@ -857,37 +896,25 @@ void pMGLevel::build(elliptic_t *pSolver)
 
   /** create the element lengths, using the most refined level **/
   ElementLengths *lengths = (ElementLengths *)calloc(1, sizeof(ElementLengths));
-  compute_element_lengths(lengths, pSolver);
+  compute_element_lengths(lengths, pSolver, pSolver->mesh->x, pSolver->mesh->y, pSolver->mesh->z);
 
   pfloat *casted_Sx = (pfloat *)calloc(Nq_e * Nq_e * Nelements, sizeof(pfloat));
   pfloat *casted_Sy = (pfloat *)calloc(Nq_e * Nq_e * Nelements, sizeof(pfloat));
   pfloat *casted_Sz = (pfloat *)calloc(Nq_e * Nq_e * Nelements, sizeof(pfloat));
   pfloat *casted_D = (pfloat *)calloc(Np_e * Nelements, sizeof(pfloat));
 
-  FDMOperators *op = (FDMOperators *)calloc(1, sizeof(FDMOperators));
-  gen_operators(op, lengths, elliptic);
-  for (dlong i = 0; i < Nq_e * Nq_e * Nelements; ++i) {
-    casted_Sx[i] = static_cast<pfloat>(op->Sx[i]);
-    casted_Sy[i] = static_cast<pfloat>(op->Sy[i]);
-    casted_Sz[i] = static_cast<pfloat>(op->Sz[i]);
+  {
+    std::vector<dlong> elementList(Nelements);
+    for (dlong e = 0; e < Nelements; ++e)
+      elementList[e] = e;
+    gen_operators(casted_Sx, casted_Sy, casted_Sz, casted_D, lengths, elliptic, elementList);
   }
-  for (dlong i = 0; i < Np_e * Nelements; ++i)
-    casted_D[i] = static_cast<pfloat>(op->D[i]);
-  free(op->Sx);
-  free(op->Sy);
-  free(op->Sz);
-  free(op->D);
-  free(op);
-  free(lengths->length_left_x);
-  free(lengths->length_left_y);
-  free(lengths->length_left_z);
-  free(lengths->length_middle_x);
-  free(lengths->length_middle_y);
-  free(lengths->length_middle_z);
-  free(lengths->length_right_x);
-  free(lengths->length_right_y);
-  free(lengths->length_right_z);
-  free(lengths);
+
+  // reference for the incremental refresh on moving meshes
+  if (platform->options.compareArgs("MOVING MESH", "TRUE"))
+    FDMLengths = pack_element_lengths(lengths, Nelements);
+
+  free_element_lengths(lengths);
 
   const dlong weightSize = Np * Nelements;
   o_wts = platform->device.malloc(weightSize * sizeof(pfloat));
@@ -1148,3 +1175,93 @@ void pMGLevel::smoothSchwarz(occa::memory &o_u, occa::memory &o_Su, bool xIsZero
   const double factor = std::is_same<pfloat, float>::value ? 0.5 : 1.0;
   platform->flopCounter->add(elliptic->name + " Schwarz, N=" + std::to_string(mesh->N), factor * flops);
 }
+
+void ellipticMultiGridUpdateSchwarz(elliptic_t *elliptic)
+{
+  // lengths changing less than this (relative) keep their FDM operators
+  constexpr double lengthTol = 1e-2;
+
+  MGSolver_t::multigridLevel **levels = elliptic->precon->MGSolver->levels;
+  auto fineLevel = dynamic_cast<pMGLevel *>(levels[0]);
+
+  int interval = 1;
+  elliptic->options.getArgs("MULTIGRID SCHWARZ UPDATE INTERVAL", interval);
+  if (interval <= 0 || ++fineLevel->FDMUpdateCounter < interval)
+    return;
+  fineLevel->FDMUpdateCounter = 0;
+
+  bool schwarz = false;
+  for (int levelIndex = 0; levelIndex < elliptic->nLevels; levelIndex++)
+    schwarz |= !dynamic_cast<pMGLevel *>(levels[levelIndex])->FDMLengths.empty();
+  if (!schwarz)
+    return;
+
+  platform->timer.tic(elliptic->name + " Schwarz update", 1);
+
+  // element lengths of the current (fine) mesh
+  elliptic_t *ellipticFine = fineLevel->elliptic;
+  mesh_t *mesh = ellipticFine->mesh;
+  const dlong Nelements = mesh->Nelements;
+  std::vector<dfloat> x(mesh->Nlocal), y(mesh->Nlocal), z(mesh->Nlocal);
+  mesh->o_x.copyTo(x.data(), mesh->Nlocal * sizeof(dfloat));
+  mesh->o_y.copyTo(y.data(), mesh->Nlocal * sizeof(dfloat));
+  mesh->o_z.copyTo(z.data(), mesh->Nlocal * sizeof(dfloat));
+
+  ElementLengths *lengths = (ElementLengths *)calloc(1, sizeof(ElementLengths));
+  compute_element_lengths(lengths, ellipticFine, x.data(), y.data(), z.data());
+  const auto currentLengths = pack_element_lengths(lengths, Nelements);
+
+  hlong NelementsUpdated = 0;
+  for (int levelIndex = 0; levelIndex < elliptic->nLevels; levelIndex++) {
+    auto level = dynamic_cast<pMGLevel *>(levels[levelIndex]);
+    if (level->FDMLengths.empty())
+      continue;
+
+    std::vector<dlong> elementList;
+    for (dlong e = 0; e < Nelements; ++e) {
+      bool changed = false;
+      for (int i = 0; i < 9; ++i) {
+        const dfloat l0 = level->FDMLengths[i * Nelements + e];
+        const dfloat l1 = currentLengths[i * Nelements + e];
+        changed |= std::abs(l1 - l0) > lengthTol * std::abs(l0);
+      }
+      if (!changed)
+        continue;
+
+      elementList.push_back(e);
+      for (int i = 0; i < 9; ++i)
+        level->FDMLengths[i * Nelements + e] = currentLengths[i * Nelements + e];
+    }
+    if (levelIndex == 0)
+      NelementsUpdated = elementList.size();
+    if (elementList.empty())
+      continue;
+
+    // patch the listed elements into the device operators
+    const int Nq_e = level->mesh->Nq + 2;
+    const dlong NS = static_cast<dlong>(Nq_e) * Nq_e * Nelements;
+    const dlong NinvL = static_cast<dlong>(Nq_e) * Nq_e * Nq_e * Nelements;
+    std::vector<pfloat> Sx(NS), Sy(NS), Sz(NS), invL(NinvL);
+    level->o_Sx.copyTo(Sx.data(), NS * sizeof(pfloat));
+    level->o_Sy.copyTo(Sy.data(), NS * sizeof(pfloat));
+    level->o_Sz.copyTo(Sz.data(), NS * sizeof(pfloat));
+    level->o_invL.copyTo(invL.data(), NinvL * sizeof(pfloat));
+
+    gen_operators(Sx.data(), Sy.data(), Sz.data(), invL.data(), lengths, level->elliptic, elementList);
+
+    level->o_Sx.copyFrom(Sx.data(), NS * sizeof(pfloat));
+    level->o_Sy.copyFrom(Sy.data(), NS * sizeof(pfloat));
+    level->o_Sz.copyFrom(Sz.data(), NS * sizeof(pfloat));
+    level->o_invL.copyFrom(invL.data(), NinvL * sizeof(pfloat));
+  }
+
+  free_element_lengths(lengths);
+
+  platform->timer.toc(elliptic->name + " Schwarz update");
+
+  if (platform->options.compareArgs("VERBOSE", "TRUE")) {
+    MPI_Allreduce(MPI_IN_PLACE, &NelementsUpdated, 1, MPI_HLONG, MPI_SUM, platform->comm.mpiComm);
+    if (platform->comm.mpiRank == 0)
+      printf("%s Schwarz update: %lld elements\n", elliptic->name.c_str(), static_cast<long long>(NelementsUpdated));
+  }
+}
@@ -24,10 +24,12 @@ ellipticMultiGridUpdateLambda(elliptic_t* elliptic)
 
     precon_t *precon = ellipticCoarse->precon;
     precon->coarsenKernel(ellipticCoarse->mesh->Nelements, 
+                          ellipticCoarse->mesh->o_elementList,
                           ellipticCoarse->o_interp, 
                           ellipticFine->o_lambda0, ellipticCoarse->o_lambda0);
     if(!elliptic->poisson)
       precon->coarsenKernel(ellipticCoarse->mesh->Nelements, 
+                            ellipticCoarse->mesh->o_elementList,
                             ellipticCoarse->o_interp, 
                             ellipticFine->o_lambda1, ellipticCoarse->o_lambda1);
  
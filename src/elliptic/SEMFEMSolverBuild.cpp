@@ -3,6 +3,7 @@
 #include <unordered_map>
 #include <unordered_set>
 #include <algorithm>
+#include <vector>
 
 #include "SEMFEMSolver.hpp"
 #include "platform.hpp"
@@ -52,17 +53,6 @@ long long bisection_search_index(const long long *sortedArr, long long value, lo
   return fail;
 }
 
-long long linear_search_index(const long long *unsortedArr, long long value, long long start, long long end)
-{
-  long long fail = -1;
-  for (long long idx = start; idx < end; ++idx) {
-    if (unsortedArr[idx] == value) {
-      return idx;
-    }
-  }
-  return fail;
-}
-
 /* Basis functions and derivatives in 3D */
 double phi_3D_1(double q_r[4][3], int q) { return q_r[q][0]; }
 double phi_3D_2(double q_r[4][3], int q) { return q_r[q][1]; }
@@ -474,7 +464,6 @@ void construct_coo_graph()
   int E_y = n_y - 1;
   int E_z = n_z - 1;
 
-  std::unordered_map<long long, std::unordered_set<long long>> graph;
   std::unordered_map<int, std::unordered_set<int>> rowIdxToColIdxMap;
   const int nvert = 8;
   for (int s_z = 0; s_z < E_z; s_z++) {
@@ -506,6 +495,20 @@ void construct_coo_graph()
       }
     }
   }
+  // collect (row, col) pairs element by element, sort and remove duplicates
+  // once a chunk is full and merge it into the unique set to bound memory
+  using entry_t = std::pair<long long, long long>;
+  std::vector<entry_t> graph;
+  size_t nUnique = 0;
+  const size_t chunkSize = 1 << 22;
+  auto compress = [&]() {
+    std::sort(graph.begin() + nUnique, graph.end());
+    graph.erase(std::unique(graph.begin() + nUnique, graph.end()), graph.end());
+    std::inplace_merge(graph.begin(), graph.begin() + nUnique, graph.end());
+    graph.erase(std::unique(graph.begin(), graph.end()), graph.end());
+    nUnique = graph.size();
+  };
+
   for (int e = 0; e < n_elem; ++e) {
     for (auto &&idx_row_lookup_and_col_lookups : rowIdxToColIdxMap) {
       auto row_lookup = idx_row_lookup_and_col_lookups.first;
@@ -513,36 +516,39 @@ void construct_coo_graph()
         if (pmask[e * n_xyz + row_lookup] > 0.0 && pmask[e * n_xyz + col_lookup] > 0.0) {
           long long row = glo_num[e * n_xyz + row_lookup];
           long long col = glo_num[e * n_xyz + col_lookup];
-          graph[row].emplace(col);
+          graph.emplace_back(row, col);
         }
       }
     }
+    if (graph.size() - nUnique > chunkSize)
+      compress();
   }
-  const int nrows = graph.size();
-  long long *rows = (long long *)malloc(nrows * sizeof(long long));
-  long long *rowOffsets = (long long *)malloc((nrows + 1) * sizeof(long long));
-  int *ncols = (int *)malloc(nrows * sizeof(int));
-  long long nnz = 0;
-  long long ctr = 0;
+  compress();
 
-  for (auto &&row_and_colset : graph) {
-    rows[ctr++] = row_and_colset.first;
-    nnz += row_and_colset.second.size();
+  const long long nnz = graph.size();
+  int nrows = 0;
+  for (long long n = 0; n < nnz; ++n) {
+    if (n == 0 || graph[n].first != graph[n - 1].first)
+      nrows++;
   }
+
+  long long *rows = (long long *)malloc(nrows * sizeof(long long));
+  long long *rowOffsets = (long long *)malloc((nrows + 1) * sizeof(long long));
+  int *ncols = (int *)calloc(nrows, sizeof(int));
   long long *cols = (long long *)malloc(nnz * sizeof(long long));
   float *vals = (float *)calloc(nnz, sizeof(float));
-  std::sort(rows, rows + nrows);
-  long long entryCtr = 0;
+
+  // rows and columns within a row are sorted
+  int localrow = -1;
   rowOffsets[0] = 0;
-  for (auto localrow = 0; localrow < nrows; ++localrow) {
-    const long long row = rows[localrow];
-    const auto &colset = graph[row];
-    const auto size = colset.size();
-    ncols[localrow] = size;
-    rowOffsets[localrow + 1] = rowOffsets[localrow] + size;
-    for (auto &&col : colset) {
-      cols[entryCtr++] = col;
+  for (long long n = 0; n < nnz; ++n) {
+    if (n == 0 || graph[n].first != graph[n - 1].first) {
+      localrow++;
+      rows[localrow] = graph[n].first;
     }
+    ncols[localrow]++;
+    rowOffsets[localrow + 1] = n + 1;
+    cols[n] = graph[n].second;
   }
 
   coo_graph.nrows = nrows;
@@ -670,7 +676,7 @@ void fem_assembly_host(hypreWrapper::IJ_t &hypreIJ)
                   long long start = rowOffsets[local_row_id];
                   long long end = rowOffsets[local_row_id + 1];
 
-                  long long id = linear_search_index(cols, col, start, end);
+                  long long id = bisection_search_index(cols, col, start, end);
                   vals[id] += lambda0 * A_loc[i][j];
                 }
               }
@@ -4,7 +4,8 @@
 #include <string.h>
 #include <mpi.h>
 #include <vector>
-#include <map>
+#include <numeric>
+#include <algorithm>
 
 #ifdef _OPENMP
 #include "omp.h"
@@ -21,6 +22,54 @@ static int HYPREinit = 0;
 
 namespace hypreWrapper {
 
+namespace {
+// Group COO entries by row (sorted by row and column) and sum duplicates.
+// The input is typically already sorted, in which case no sort is done.
+void cooToCSR(int nz,
+              const long long int *Ai,
+              const long long int *Aj,
+              const double *Av,
+              std::vector<HYPRE_BigInt> &rows,
+              std::vector<HYPRE_Int> &ncols,
+              std::vector<HYPRE_BigInt> &cols,
+              std::vector<HYPRE_Real> &vals)
+{
+  auto less = [&](int a, int b) { return (Ai[a] < Ai[b]) || (Ai[a] == Ai[b] && Aj[a] < Aj[b]); };
+
+  bool sorted = true;
+  for (int i = 1; i < nz && sorted; i++)
+    sorted = !less(i, i - 1);
+
+  std::vector<int> perm;
+  if (!sorted) {
+    perm.resize(nz);
+    std::iota(perm.begin(), perm.end(), 0);
+    std::sort(perm.begin(), perm.end(), less);
+  }
+
+  cols.reserve(nz);
+  vals.reserve(nz);
+  for (int n = 0; n < nz; n++) {
+    const int i = sorted ? n : perm[n];
+    const auto row = (HYPRE_BigInt)Ai[i];
+    const auto col = (HYPRE_BigInt)Aj[i];
+
+    if (rows.empty() || rows.back() != row) {
+      rows.push_back(row);
+      ncols.push_back(0);
+    }
+    else if (cols.back() == col) {
+      vals.back() += (HYPRE_Real)Av[i];
+      continue;
+    }
+
+    cols.push_back(col);
+    vals.push_back((HYPRE_Real)Av[i]);
+    ncols.back()++;
+  }
+}
+} // namespace
+
 __attribute__((visibility("default")))
 boomerAMG_t::boomerAMG_t(int _nRows,
                    int nz,
@@ -80,43 +129,22 @@ boomerAMG_t::boomerAMG_t(int _nRows,
   HYPRE_IJMatrixSetObjectType(*A, HYPRE_PARCSR);
   HYPRE_IJMatrixInitialize(*A);
 
-  std::map<HYPRE_BigInt, std::vector<std::pair<HYPRE_BigInt, HYPRE_Real>>> rowToColAndVal;
-  for (int i = 0; i < nz; i++) {
-    HYPRE_BigInt mati = (HYPRE_BigInt)(Ai[i]);
-    HYPRE_BigInt matj = (HYPRE_BigInt)(Aj[i]);
-    HYPRE_Real matv = (HYPRE_Real)Av[i];
-    rowToColAndVal[mati].emplace_back(std::make_pair(matj, matv));
-  }
+  const double tAssemble = MPI_Wtime();
+  {
+    std::vector<HYPRE_BigInt> rows;
+    std::vector<HYPRE_Int> ncols;
+    std::vector<HYPRE_BigInt> cols;
+    std::vector<HYPRE_Real> vals;
+    cooToCSR(nz, Ai, Aj, Av, rows, ncols, cols, vals);
 
-  const HYPRE_Int rowsToSet = rowToColAndVal.size();
-  std::vector<HYPRE_Int> ncols(rowsToSet);
-  std::vector<HYPRE_BigInt> rows(rowsToSet);
-  std::vector<HYPRE_BigInt> cols(nz);
-  std::vector<HYPRE_Real> vals(nz);
-
-  unsigned rowCtr = 0;
-  unsigned colCtr = 0;
-  for (auto &&rowAndColValPair : rowToColAndVal) {
-    const auto &row = rowAndColValPair.first;
-    const auto &colAndValues = rowAndColValPair.second;
-
-    rows[rowCtr] = row;
-    ncols[rowCtr] = colAndValues.size();
-
-    for (auto &&colAndValue : colAndValues) {
-      const auto &col = colAndValue.first;
-      const auto &val = colAndValue.second;
-      cols[colCtr] = col;
-      vals[colCtr] = val;
-      ++colCtr;
-    }
-    ++rowCtr;
+    HYPRE_IJMatrixSetValues(*A, rows.size(), ncols.data(), rows.data(), cols.data(), vals.data());
   }
 
-  HYPRE_IJMatrixSetValues(*A, rowsToSet, ncols.data(), rows.data(), cols.data(), vals.data());
-
   HYPRE_IJMatrixAssemble(*A);
 
+  if (verbose && rank == 0)
+    printf("hypreWrapper: matrix assembly (nnz=%d) %gs\n", nz, MPI_Wtime() - tAssemble);
+
   if(DEBUG)
     HYPRE_IJMatrixPrint(*A, "matrix.dat");
 
@@ -1,6 +1,6 @@
 #include <mpi.h>
 #include <cstdio>
-#include <map>
+#include <algorithm>
 #include <vector>
 
 #ifdef ENABLE_HYPRE_GPU
@@ -106,58 +106,37 @@ boomerAMG_t::boomerAMG_t(int _nRows,
     HYPRE_IJMatrixSetObjectType(*A, HYPRE_PARCSR);
     HYPRE_IJMatrixInitialize(*A);
 
-    std::map<HYPRE_BigInt, std::vector<std::pair<HYPRE_BigInt, HYPRE_Real>>> rowToColAndVal;
-    for (int i = 0; i < nz; i++) {
-      HYPRE_BigInt mati = (HYPRE_BigInt)(Ai[i]);
-      HYPRE_BigInt matj = (HYPRE_BigInt)(Aj[i]);
-      HYPRE_Real matv = (HYPRE_Real)Av[i];
-      rowToColAndVal[mati].emplace_back(std::make_pair(matj, matv));
+    // Pass the raw COO entries in chunks, hypre sorts and reduces them on the
+    // device during assembly. Adding to the zero initialized matrix sums duplicates.
+    const double tAssemble = MPI_Wtime();
+    const int chunkSize = 1 << 22;
+    for (int offset = 0; offset < nz; offset += chunkSize) {
+      const int n = std::min(chunkSize, nz - offset);
+      std::vector<HYPRE_BigInt> rows(Ai + offset, Ai + offset + n);
+      std::vector<HYPRE_BigInt> cols(Aj + offset, Aj + offset + n);
+      std::vector<HYPRE_Real> vals(Av + offset, Av + offset + n);
+
+      auto o_rows = device.malloc(n * sizeof(HYPRE_BigInt), rows.data());
+      auto o_cols = device.malloc(n * sizeof(HYPRE_BigInt), cols.data());
+      auto o_vals = device.malloc(n * sizeof(HYPRE_Real), vals.data());
+
+      HYPRE_IJMatrixAddToValues(*A,
+                                n /* one value per row entry */,
+                                nullptr,
+                                (HYPRE_BigInt *)o_rows.ptr(),
+                                (HYPRE_BigInt *)o_cols.ptr(),
+                                (HYPRE_Real *)o_vals.ptr());
+
+      o_rows.free();
+      o_cols.free();
+      o_vals.free();
     }
 
-    const HYPRE_Int rowsToSet = rowToColAndVal.size();
-    std::vector<HYPRE_Int> ncols(rowsToSet);
-    std::vector<HYPRE_BigInt> rows(rowsToSet);
-    std::vector<HYPRE_BigInt> cols(nz);
-    std::vector<HYPRE_Real> vals(nz);
-
-    unsigned rowCtr = 0;
-    unsigned colCtr = 0;
-    for (auto &&rowAndColValPair : rowToColAndVal) {
-      const auto &row = rowAndColValPair.first;
-      const auto &colAndValues = rowAndColValPair.second;
-
-      rows[rowCtr] = row;
-      ncols[rowCtr] = colAndValues.size();
-
-      for (auto &&colAndValue : colAndValues) {
-        const auto &col = colAndValue.first;
-        const auto &val = colAndValue.second;
-        cols[colCtr] = col;
-        vals[colCtr] = val;
-        ++colCtr;
-      }
-      ++rowCtr;
-    }
-
-    auto o_ncols = device.malloc(ncols.size() * sizeof(HYPRE_Int), ncols.data());
-    auto o_rows = device.malloc(rows.size() * sizeof(HYPRE_BigInt), rows.data());
-    auto o_cols = device.malloc(cols.size() * sizeof(HYPRE_BigInt), cols.data());
-    auto o_vals = device.malloc(vals.size() * sizeof(HYPRE_Real), vals.data());
-
-    HYPRE_IJMatrixSetValues(*A,
-                            rowsToSet /* values for nrows */,
-                            (HYPRE_Int *)o_ncols.ptr() /* cols for each row */,
-                            (HYPRE_BigInt *)o_rows.ptr(),
-                            (HYPRE_BigInt *)o_cols.ptr(),
-                            (HYPRE_Real *)o_vals.ptr());
-
-    o_ncols.free();
-    o_rows.free();
-    o_cols.free();
-    o_vals.free();
-
     HYPRE_IJMatrixAssemble(*A);
 
+    if (verbose && rank == 0)
+      printf("hypreWrapperDevice: matrix assembly (nnz=%d) %gs\n", nz, MPI_Wtime() - tAssemble);
+
     if(DEBUG)
       HYPRE_IJMatrixPrint(*A, "matrix.dat");
   }
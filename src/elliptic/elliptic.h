@@ -51,6 +51,7 @@
 class SolutionProjection;
 class precon_t;
 class elliptic_t;
+class MGAutotuner_t;
 
 struct GmresData{
   GmresData(elliptic_t*);
@@ -70,6 +71,15 @@ struct GmresData{
   dfloat* scratch;
 };
 
+struct PipelinedPcgData{
+  PipelinedPcgData(elliptic_t*);
+  deviceVector_t o_v; // m, n, z, q, s
+  dlong Nblocks;
+  occa::memory o_reduction;
+  occa::memory h_reduction;
+  dfloat* reduction;
+};
+
 struct elliptic_t
 {
   static constexpr double targetTimeBenchmark {0.2};
@@ -94,6 +104,7 @@ struct elliptic_t
   mesh_t* mesh;
 
   precon_t *precon = nullptr;
+  MGAutotuner_t *MGAutotuner = nullptr;
 
   ogs_t* ogs;
   oogs_t* oogs;
@@ -136,6 +147,8 @@ struct elliptic_t
   occa::memory o_zPfloat;
 
   occa::memory o_EXYZ; // element vertices for reconstructing geofacs (trilinear hexes only)
+  occa::memory o_XYZ;  // element GLL coordinates for reconstructing geofacs (curved hexes)
+  occa::memory o_gllzw;
 
   occa::kernel AxKernel;
   occa::kernel AxPfloatKernel;
@@ -159,6 +172,7 @@ struct elliptic_t
   dfloat* tmpNormr;
   occa::memory o_tmpNormr;
   occa::kernel updatePCGKernel;
+  occa::kernel updatePipelinedPCGKernel;
 
   hlong NelementsGlobal;
 
@@ -173,6 +187,7 @@ struct elliptic_t
 
   SolutionProjection* solutionProjection;
   GmresData *gmresData;
+  PipelinedPcgData *pipelinedPcgData;
 
   std::function<void(dlong Nelements, occa::memory &o_elementList, occa::memory &o_x)> applyZeroNormalMask;
   std::function<void(occa::memory & o_r, occa::memory & o_z)> userPreconditioner;
@@ -195,6 +210,9 @@ void ellipticSolveSetup(elliptic_t* elliptic);
 int pcg(elliptic_t* elliptic, occa::memory &o_r, occa::memory &o_x,
         const dfloat tol, const int MAXIT, dfloat &res);
 
+int pipelinedPcg(elliptic_t* elliptic, occa::memory &o_r, occa::memory &o_x,
+        const dfloat tol, const int MAXIT, dfloat &res);
+
 void initializeGmresData(elliptic_t*);
 int pgmres(elliptic_t* elliptic, occa::memory &o_r, occa::memory &o_x,
         const dfloat tol, const int MAXIT, dfloat &res);
@@ -213,6 +231,7 @@ void ellipticAx(elliptic_t* elliptic,
                 const char* precision);
 
 void ellipticMultiGridUpdateLambda(elliptic_t* elliptic);
+void ellipticMultiGridUpdateSchwarz(elliptic_t* elliptic);
 void ellipticUpdateJacobi(elliptic_t *ellipticBase, occa::memory &o_invDiagA);
 void ellipticUpdateJacobi(elliptic_t* elliptic);
 
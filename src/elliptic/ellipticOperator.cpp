@@ -80,19 +80,37 @@ void ellipticAx(elliptic_t* elliptic,
   occa::kernel &AxKernel =
       (precisionStr != dFloatStr) ? elliptic->AxPfloatKernel : elliptic->AxKernel;
 
-  AxKernel(NelementsList,
-           elliptic->fieldOffset,
-           elliptic->loffset,
-           o_elementsList,
-           o_geom_factors,
-           o_D,
-           o_DT,
-           o_lambda0,
-           o_lambda1,
-           o_q,
-           o_Aq);
+  const bool recomputeGeom = elliptic->o_XYZ.size() && precisionStr == dFloatStr;
+
+  if (recomputeGeom)
+    AxKernel(NelementsList,
+             elliptic->fieldOffset,
+             elliptic->loffset,
+             o_elementsList,
+             elliptic->o_XYZ,
+             elliptic->o_gllzw,
+             o_D,
+             o_DT,
+             o_lambda0,
+             o_lambda1,
+             o_q,
+             o_Aq);
+  else
+    AxKernel(NelementsList,
+             elliptic->fieldOffset,
+             elliptic->loffset,
+             o_elementsList,
+             o_geom_factors,
+             o_D,
+             o_DT,
+             o_lambda0,
+             o_lambda1,
+             o_q,
+             o_Aq);
 
   double flopCount = mesh->Np * 12 * mesh->Nq + 15 * mesh->Np;
+  if (recomputeGeom)
+    flopCount += mesh->Np * 18 * mesh->Nq + 60 * mesh->Np;
   if(coeffField)
     flopCount += 3 * mesh->Np;
   else 
@@ -63,8 +63,11 @@ void ellipticPreconditionerSetup(elliptic_t* elliptic, ogs_t* ogs)
 
   precon->preconBytes = platform->device.occaDevice().memoryAllocated() - pre;
 
-  MPI_Barrier(platform->comm.mpiComm);
-  if(platform->comm.mpiRank == 0)  printf("done (%gs)\n", MPI_Wtime() - tStart); fflush(stdout);
+  long long int maxPreconBytes = precon->preconBytes;
+  MPI_Allreduce(MPI_IN_PLACE, &maxPreconBytes, 1, MPI_LONG_LONG_INT, MPI_MAX, platform->comm.mpiComm);
+  if(platform->comm.mpiRank == 0)
+    printf("done (%gs, %.2f MB device memory per rank)\n", MPI_Wtime() - tStart, maxPreconBytes / 1e6);
+  fflush(stdout);
 }
 
 precon_t::~precon_t()
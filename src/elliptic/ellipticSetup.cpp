@@ -28,6 +28,7 @@
 #include "ellipticPrecon.h"
 #include "platform.hpp"
 #include "linAlg.hpp"
+#include "MGAutotuner.hpp"
 
 void checkConfig(elliptic_t *elliptic)
 {
@@ -70,6 +71,19 @@ void checkConfig(elliptic_t *elliptic)
     }
   }
 
+  if (options.compareArgs("ELLIPTIC GEOMETRY", "RECOMPUTE")) {
+    if (elliptic->blockSolver) {
+      if (platform->comm.mpiRank == 0)
+        printf("Recomputing geometric factors is not supported by block solver\n");
+      err++;
+    }
+    if (platform->options.compareArgs("MOVING MESH", "TRUE")) {
+      if (platform->comm.mpiRank == 0)
+        printf("Recomputing geometric factors is not supported for moving meshes\n");
+      err++;
+    }
+  }
+
   if (elliptic->mesh->ogs == NULL) {
     if (platform->comm.mpiRank == 0)
       printf("mesh->ogs == NULL!");
@@ -165,6 +179,33 @@ void ellipticSolveSetup(elliptic_t *elliptic)
     elliptic->fusedResidualAndNormKernel = platform->kernels.get(sectionIdentifier + "fusedResidualAndNorm");
   }
 
+  if (options.compareArgs("ELLIPTIC GEOMETRY", "RECOMPUTE")) {
+    // element-wise packed GLL coordinates XYZ[e][3][Np] and [gllz, gllw]
+    std::vector<dfloat> xyz(3 * Nlocal);
+    std::vector<dfloat> tmp(Nlocal);
+    int dim = 0;
+    for (auto o_coord : {mesh->o_x, mesh->o_y, mesh->o_z}) {
+      o_coord.copyTo(tmp.data(), Nlocal * sizeof(dfloat));
+      for (dlong e = 0; e < mesh->Nelements; e++)
+        for (int n = 0; n < mesh->Np; n++)
+          xyz[n + dim * mesh->Np + e * 3 * mesh->Np] = tmp[n + e * mesh->Np];
+      dim++;
+    }
+    elliptic->o_XYZ = platform->device.malloc(xyz.size() * sizeof(dfloat), xyz.data());
+
+    std::vector<dfloat> gllzw(2 * mesh->Nq);
+    std::copy(mesh->gllz, mesh->gllz + mesh->Nq, gllzw.begin());
+    std::copy(mesh->gllw, mesh->gllw + mesh->Nq, gllzw.begin() + mesh->Nq);
+    elliptic->o_gllzw = platform->device.malloc(gllzw.size() * sizeof(dfloat), gllzw.data());
+  }
+
+  if (options.compareArgs("SOLVER", "PIPELINED")) {
+    elliptic->pipelinedPcgData = new PipelinedPcgData(elliptic);
+    const std::string sectionIdentifier = std::to_string(elliptic->Nfields) + "-";
+    elliptic->updatePipelinedPCGKernel =
+        platform->kernels.get(sectionIdentifier + "ellipticBlockUpdatePipelinedPCG");
+  }
+
   mesh->maskKernel = platform->kernels.get("mask");
   mesh->maskPfloatKernel = platform->kernels.get("maskPfloat");
 
@@ -234,11 +275,15 @@ void ellipticSolveSetup(elliptic_t *elliptic)
     kernelNamePrefix += "elliptic";
     if (elliptic->blockSolver)
       kernelNamePrefix += (elliptic->stressForm) ? "Stress" : "Block";
+    if (elliptic->blockSolver && !elliptic->stressForm && elliptic->Nfields != 3)
+      kernelNamePrefix += "N";
 
     kernelName = "Ax";
     kernelName += "Coeff";
     if (platform->options.compareArgs("ELEMENT MAP", "TRILINEAR"))
       kernelName += "Trilinear";
+    else if (elliptic->o_XYZ.size())
+      kernelName += "Isoparametric";
     kernelName += suffix;
 
     elliptic->AxKernel = platform->kernels.get(kernelNamePrefix + "Partial" + kernelName);
@@ -297,6 +342,9 @@ void ellipticSolveSetup(elliptic_t *elliptic)
 
   ellipticPreconditionerSetup(elliptic, elliptic->ogs);
 
+  if (options.compareArgs("MULTIGRID AUTOTUNE", "TRUE"))
+    elliptic->MGAutotuner = new MGAutotuner_t(elliptic);
+
   if (options.compareArgs("INITIAL GUESS", "PROJECTION") ||
       options.compareArgs("INITIAL GUESS", "PROJECTION-ACONJ")) {
     dlong nVecsProject = 8;
@@ -322,6 +370,8 @@ void ellipticSolveSetup(elliptic_t *elliptic)
 
 elliptic_t::~elliptic_t()
 {
+  if (MGAutotuner)
+    delete this->MGAutotuner;
   if (precon)
     delete this->precon;
   free(this->tmpNormr);
@@ -28,6 +28,7 @@
 #include "ellipticPrecon.h"
 #include "platform.hpp"
 #include "linAlg.hpp"
+#include "MGAutotuner.hpp"
 
 
 void ellipticSolve(elliptic_t* elliptic, occa::memory &o_r, occa::memory &o_x)
@@ -42,6 +43,8 @@ void ellipticSolve(elliptic_t* elliptic, occa::memory &o_r, occa::memory &o_x)
     name = "scalar";
   }
 
+  if(elliptic->MGAutotuner) elliptic->MGAutotuner->tic();
+
   int maxIter = 999;
   options.getArgs("MAXIMUM ITERATIONS", maxIter);
   const int verbose = platform->options.compareArgs("VERBOSE", "TRUE");
@@ -86,6 +89,11 @@ void ellipticSolve(elliptic_t* elliptic, occa::memory &o_r, occa::memory &o_x)
     }
   }
 
+  if(platform->options.compareArgs("MOVING MESH", "TRUE") &&
+     options.compareArgs("PRECONDITIONER", "MULTIGRID")) {
+    ellipticMultiGridUpdateSchwarz(elliptic);
+  }
+
   // compute initial residual r = rhs - Ax0
   ellipticAx(elliptic, mesh->Nelements, mesh->o_elementList, o_x, elliptic->o_Ap, dfloatString);
   platform->linAlg->axpbyMany(
@@ -148,7 +156,9 @@ void ellipticSolve(elliptic_t* elliptic, occa::memory &o_r, occa::memory &o_x)
   if(!options.compareArgs("SOLVER", "NONBLOCKING")) {
     elliptic->resNorm = elliptic->res0Norm;
 
-    if(options.compareArgs("SOLVER", "PCG")) {
+    if(options.compareArgs("SOLVER", "PIPELINED")) {
+      elliptic->Niter = pipelinedPcg (elliptic, o_r, o_x, tol, maxIter, elliptic->resNorm);
+    } else if(options.compareArgs("SOLVER", "PCG")) {
       elliptic->Niter = pcg (elliptic, o_r, o_x, tol, maxIter, elliptic->resNorm);
     } else if(options.compareArgs("SOLVER", "PGMRES")) {
       elliptic->Niter = pgmres (elliptic, o_r, o_x, tol, maxIter, elliptic->resNorm);
@@ -186,4 +196,12 @@ void ellipticSolve(elliptic_t* elliptic, occa::memory &o_r, occa::memory &o_x)
 
   if(elliptic->allNeumann)
     ellipticZeroMean(elliptic, o_x);
+
+  if(elliptic->MGAutotuner) {
+    elliptic->MGAutotuner->toc();
+    if(elliptic->MGAutotuner->done()) {
+      delete elliptic->MGAutotuner;
+      elliptic->MGAutotuner = nullptr;
+    }
+  }
 }
@@ -27,6 +27,7 @@
 #include "elliptic.h"
 #include "timer.hpp"
 #include "linAlg.hpp"
+#include <limits>
 
 GmresData::GmresData(elliptic_t* elliptic)
 : nRestartVectors(
@@ -58,7 +59,8 @@ GmresData::GmresData(elliptic_t* elliptic)
     h_scratch = platform->device.mallocHost(Nbytes);
     scratch = (dfloat*) h_scratch.ptr();
 
-    h_y = platform->device.mallocHost(nRestartVectors * sizeof(dfloat));
+    // one extra entry for (w,w) of the single-reduction Arnoldi step
+    h_y = platform->device.mallocHost((nRestartVectors + 1) * sizeof(dfloat));
     y = (dfloat*) h_y.ptr();
   }
   o_scratch = platform->device.malloc(Nbytes);
@@ -163,6 +165,7 @@ int pgmres(elliptic_t* elliptic, occa::memory &o_r, occa::memory &o_x,
   const int nRestartVectors = elliptic->gmresData->nRestartVectors;
 
   const int flexible = elliptic->options.compareArgs("SOLVER", "FLEXIBLE");
+  const int lowSync = elliptic->options.compareArgs("SOLVER", "LOWSYNC");
 
   const bool verbose = platform->options.compareArgs("VERBOSE", "TRUE");
   const bool serial = platform->device.mode() == "Serial" || platform->device.mode() == "OpenMP";
@@ -208,6 +211,30 @@ int pgmres(elliptic_t* elliptic, occa::memory &o_r, occa::memory &o_x,
       // w := A z
       ellipticOperator(elliptic, o_Mv, o_w, dfloatString);
 
+      if (lowSync) {
+        // local (V(:,0:i),w) and (w,w) followed by a single reduction
+        linAlg.weightedInnerProdMulti(
+          mesh->Nlocal,
+          (i+1),
+          elliptic->Nfields,
+          elliptic->fieldOffset,
+          o_weight,
+          o_V,
+          o_w,
+          MPI_COMM_SELF,
+          y
+        );
+        y[i+1] = linAlg.weightedInnerProdMany(
+          mesh->Nlocal,
+          elliptic->Nfields,
+          elliptic->fieldOffset,
+          o_weight,
+          o_w,
+          o_w,
+          MPI_COMM_SELF);
+        MPI_Allreduce(MPI_IN_PLACE, y, (i+2), MPI_DFLOAT, MPI_SUM, platform->comm.mpiComm);
+        o_y.copyFrom(y, (i+1)*sizeof(dfloat));
+      } else {
 #if USE_WEIGHTED_INNER_PROD_MULTI_DEVICE 
       linAlg.weightedInnerProdMulti(
         mesh->Nlocal,
@@ -235,6 +262,7 @@ int pgmres(elliptic_t* elliptic, occa::memory &o_r, occa::memory &o_x,
       );
       o_y.copyFrom(y, (i+1)*sizeof(dfloat));
 #endif
+      }
 
       elliptic->gramSchmidtOrthogonalizationKernel(
         Nblock,
@@ -248,17 +276,30 @@ int pgmres(elliptic_t* elliptic, occa::memory &o_r, occa::memory &o_x,
         elliptic->gmresData->o_scratch);
       dfloat nw = 0.0;
 
+      // ||w - V y||^2 = ||w||^2 - ||y||^2 (Pythagoras) unless too much cancellation
+      bool explicitNorm = true;
+      if (lowSync) {
+        dfloat nw2 = y[i+1];
+        for(int k = 0; k <= i; ++k)
+          nw2 -= y[k] * y[k];
+        if (nw2 > std::sqrt(std::numeric_limits<dfloat>::epsilon()) * y[i+1]) {
+          nw = nw2;
+          explicitNorm = false;
+        }
+      }
 
-      if(serial){
-        nw = *((dfloat*) elliptic->gmresData->o_scratch.ptr());
-      } else {
-        elliptic->gmresData->o_scratch.copyTo(
-          elliptic->gmresData->scratch,
-          sizeof(dfloat) * Nblock);
-        for(int k = 0; k < Nblock; ++k)
-          nw += elliptic->gmresData->scratch[k];
+      if (explicitNorm) {
+        if(serial){
+          nw = *((dfloat*) elliptic->gmresData->o_scratch.ptr());
+        } else {
+          elliptic->gmresData->o_scratch.copyTo(
+            elliptic->gmresData->scratch,
+            sizeof(dfloat) * Nblock);
+          for(int k = 0; k < Nblock; ++k)
+            nw += elliptic->gmresData->scratch[k];
+        }
+        MPI_Allreduce(MPI_IN_PLACE, &nw, 1, MPI_DFLOAT, MPI_SUM, platform->comm.mpiComm);
       }
-      MPI_Allreduce(MPI_IN_PLACE, &nw, 1, MPI_DFLOAT, MPI_SUM, platform->comm.mpiComm);
       nw = sqrt(nw);
 
       {
@@ -0,0 +1,171 @@
+/*
+
+   The MIT License (MIT)
+
+   Copyright (c) 2017 Tim Warburton, Noel Chalmers, Jesse Chan, Ali Karakus
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to deal
+   in the Software without restriction, including without limitation the rights
+   to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+   copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in all
+   copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+
+ */
+
+// Pipelined PCG (Ghysels & Vanroose, Parallel Computing 40, 2014).
+// The three inner products of an iteration are fused into a single
+// non-blocking reduction which is hidden behind the preconditioner and Ax.
+
+#include "elliptic.h"
+#include "timer.hpp"
+#include "linAlg.hpp"
+
+PipelinedPcgData::PipelinedPcgData(elliptic_t* elliptic)
+: o_v(elliptic->fieldOffset * elliptic->Nfields, 5, sizeof(dfloat)),
+  Nblocks(platform->serial ? 1 : (elliptic->mesh->Nlocal + BLOCKSIZE - 1) / BLOCKSIZE)
+{
+  o_reduction = platform->device.malloc(3 * Nblocks * sizeof(dfloat));
+  h_reduction = platform->device.mallocHost(3 * Nblocks * sizeof(dfloat));
+  reduction = (dfloat*) h_reduction.ptr();
+}
+
+namespace{
+void update(elliptic_t* elliptic, const dfloat alpha, const dfloat beta,
+            occa::memory &o_x, occa::memory &o_r, dfloat* localDots)
+{
+  mesh_t* mesh = elliptic->mesh;
+  PipelinedPcgData* data = elliptic->pipelinedPcgData;
+  const dlong Nblocks = data->Nblocks;
+
+  elliptic->updatePipelinedPCGKernel(Nblocks,
+                                     mesh->Nlocal,
+                                     elliptic->fieldOffset,
+                                     elliptic->o_invDegree,
+                                     alpha,
+                                     beta,
+                                     data->o_v.at(0), // m
+                                     data->o_v.at(1), // n
+                                     data->o_v.at(2), // z
+                                     data->o_v.at(3), // q
+                                     data->o_v.at(4), // s
+                                     elliptic->o_p,
+                                     o_x,
+                                     o_r,
+                                     elliptic->o_z, // u
+                                     elliptic->o_Ap, // w
+                                     data->o_reduction);
+
+  data->o_reduction.copyTo(data->reduction, 3 * Nblocks * sizeof(dfloat));
+  for (int i = 0; i < 3; ++i) {
+    localDots[i] = 0;
+    for (dlong n = 0; n < Nblocks; ++n)
+      localDots[i] += data->reduction[n + i * Nblocks];
+  }
+
+  platform->flopCounter->add(elliptic->name + " ellipticUpdatePipelinedPCG",
+                             elliptic->Nfields * static_cast<double>(mesh->Nlocal) * 22 + 3 * mesh->Nlocal);
+}
+
+void preconditioner(elliptic_t* elliptic, occa::memory &o_w, occa::memory &o_m)
+{
+  if (elliptic->options.compareArgs("PRECONDITIONER", "NONE"))
+    o_m.copyFrom(o_w, elliptic->Nfields * elliptic->fieldOffset * sizeof(dfloat));
+  else
+    ellipticPreconditioner(elliptic, o_w, o_m);
+}
+}
+
+int pipelinedPcg(elliptic_t* elliptic, occa::memory &o_r, occa::memory &o_x,
+        const dfloat tol, const int MAXIT, dfloat &rdotr)
+{
+  const int verbose = platform->options.compareArgs("VERBOSE", "TRUE");
+  const dlong Nvec = elliptic->Nfields * elliptic->fieldOffset;
+
+  PipelinedPcgData* data = elliptic->pipelinedPcgData;
+
+  occa::memory &o_u = elliptic->o_z;
+  occa::memory &o_w = elliptic->o_Ap;
+  occa::memory &o_m = data->o_v.at(0);
+  occa::memory &o_n = data->o_v.at(1);
+
+  if(platform->comm.mpiRank == 0 && verbose) {
+    printf("PPCG ");
+    printf("%s: initial res norm %.15e WE NEED TO GET TO %e \n", elliptic->name.c_str(), rdotr, tol);
+  }
+
+  if (rdotr <= tol)
+    return 0;
+
+  // u = M r, w = A u
+  preconditioner(elliptic, o_r, o_u);
+  ellipticOperator(elliptic, o_u, o_w, dfloatString);
+
+  // zero recurrences, alpha = 0 only evaluates the inner products
+  platform->linAlg->fill(Nvec, 0.0, elliptic->o_p);
+  for (int i = 0; i < 5; ++i)
+    platform->linAlg->fill(Nvec, 0.0, data->o_v.at(i));
+
+  dfloat dots[3];
+  update(elliptic, 0.0, 0.0, o_x, o_r, dots);
+
+  dfloat alpha = 0;
+  dfloat gammaPrev = 0;
+
+  int iter = 0;
+  while (iter < MAXIT) {
+    MPI_Request request;
+    MPI_Iallreduce(MPI_IN_PLACE, dots, 3, MPI_DFLOAT, MPI_SUM, platform->comm.mpiComm, &request);
+
+    // overlap reduction with m = M w, n = A m
+    preconditioner(elliptic, o_w, o_m);
+    ellipticOperator(elliptic, o_m, o_n, dfloatString);
+
+    MPI_Wait(&request, MPI_STATUS_IGNORE);
+
+    const dfloat gamma = dots[0];
+    const dfloat delta = dots[1];
+    rdotr = sqrt(dots[2] * elliptic->resNormFactor);
+
+    if (platform->comm.mpiRank == 0)
+      nrsCheck(std::isnan(rdotr), MPI_COMM_SELF, EXIT_FAILURE,
+               "Detected invalid resiual norm while running linear solver!\n", "");
+
+    if (iter > 0 && verbose && (platform->comm.mpiRank == 0))
+      printf("it %d r norm %.15e\n", iter, rdotr);
+
+    if (iter > 0 && rdotr <= tol)
+      break;
+
+    dfloat beta = 0;
+    if (iter > 0) {
+      beta = gamma / gammaPrev;
+      alpha = gamma / (delta - beta * gamma / alpha);
+    } else {
+      alpha = gamma / (delta + 1e-300);
+    }
+    gammaPrev = gamma;
+
+    update(elliptic, alpha, beta, o_x, o_r, dots);
+    iter++;
+  }
+
+  // residual of the last update has not been reduced yet
+  if (iter == MAXIT) {
+    MPI_Allreduce(MPI_IN_PLACE, &dots[2], 1, MPI_DFLOAT, MPI_SUM, platform->comm.mpiComm);
+    rdotr = sqrt(dots[2] * elliptic->resNormFactor);
+  }
+
+  return iter;
+}
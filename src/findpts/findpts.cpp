@@ -27,9 +27,10 @@ SOFTWARE.
 // for platform
 #include "nrssys.hpp"
 #include "nrs.hpp"
-#include "tuple_for_each.hpp"
 
+#include <algorithm>
 #include <cstdlib>
+#include <tuple>
 #include <vector>
 #include "ogstypes.h"
 #include "findpts.hpp"
@@ -41,10 +42,6 @@ struct evalSrcPt_t {
   int index, proc, el;
 };
 
-template <int N> struct evalOutPt_t {
-  double out[N];
-  int index, proc;
-};
 
 // ======= Legacy setup =======
 extern "C" {
@@ -365,78 +362,199 @@ void findpts_t::findptsLocal(int *const code,
   }
 }
 
-template <typename OutputType>
-void findpts_t::findptsLocalEvalInternal(OutputType *opt,
-                                         const evalSrcPt_t *spt,
-                                         const int pn,
-                                         const int nFields,
-                                         const int inputOffset,
-                                         const int outputOffset,
-                                         occa::memory &o_in)
+void findpts_t::setupEvalPlan(const int *const code_base,
+                              const int *const proc_base,
+                              const int *const el_base,
+                              const dfloat *const r_base,
+                              const int npt)
 {
   if (timerLevel == TimerLevel::Detailed) {
-    platform->timer.tic(timerName + "findptsLocalEvalInternal", 1);
+    platform->timer.tic(timerName + "setupEvalPlan", 1);
   }
 
-  if (pn == 0) {
-    if (timerLevel == TimerLevel::Detailed) {
-      platform->timer.toc(timerName + "findptsLocalEvalInternal");
+  auto &plan = this->evalPlan;
+  plan = evalPlan_t{};
+
+  // local points owned by other ranks, grouped by owner and ordered by index
+  std::vector<std::pair<int, int>> remotePoints;
+  for (int index = 0; index < npt; ++index) {
+    if (code_base[index] != CODE_NOT_FOUND && proc_base[index] != this->rank) {
+      remotePoints.push_back({proc_base[index], index});
     }
+  }
+  std::sort(remotePoints.begin(), remotePoints.end());
 
-    // provide 0-time tic/toc to allow global reduction later in timer reporting
-    if (timerLevel != TimerLevel::None) {
-      platform->timer.tic(timerName + "findptsLocalEvalInternal::localEvalKernel", 0);
-      platform->timer.toc(timerName + "findptsLocalEvalInternal::localEvalKernel");
+  for (auto &&[proc, index] : remotePoints) {
+    if (plan.recvRanks.empty() || plan.recvRanks.back() != proc) {
+      plan.recvRanks.push_back(proc);
+      plan.recvCounts.push_back(0);
     }
-    return;
+    plan.recvCounts.back()++;
+    plan.recvIndex.push_back(index);
   }
 
-  pool::manageBuffers(pn, outputOffset, nFields);
+  // route the point records to their owners once
+  struct array src;
+  array_init(evalSrcPt_t, &src, remotePoints.size());
+  auto *pt = (evalSrcPt_t *)src.ptr;
+  for (auto &&[proc, index] : remotePoints) {
+    for (int d = 0; d < dim; ++d) {
+      pt->r[d] = r_base[dim * index + d];
+    }
+    pt->index = index;
+    pt->proc = proc;
+    pt->el = el_base[index];
+    ++pt;
+  }
+  src.n = remotePoints.size();
+  sarray_transfer(evalSrcPt_t, &src, proc, 1, this->cr);
 
-  dlong byteOffset = 0;
+  // points requested by other ranks, in the order the requester expects them
+  auto *spt = (evalSrcPt_t *)src.ptr;
+  std::sort(spt, spt + src.n, [](const evalSrcPt_t &a, const evalSrcPt_t &b) {
+    return std::tie(a.proc, a.index) < std::tie(b.proc, b.index);
+  });
 
-  auto o_out = pool::o_scratch;
-  byteOffset += nFields * pn * sizeof(dfloat);
+  plan.Nsend = src.n;
+  std::vector<dlong> el(plan.Nsend);
+  std::vector<dfloat> r(dim * plan.Nsend);
+  for (dlong point = 0; point < plan.Nsend; ++point) {
+    if (plan.sendRanks.empty() || plan.sendRanks.back() != spt[point].proc) {
+      plan.sendRanks.push_back(spt[point].proc);
+      plan.sendCounts.push_back(0);
+    }
+    plan.sendCounts.back()++;
+    el[point] = spt[point].el;
+    for (int d = 0; d < dim; ++d) {
+      r[dim * point + d] = spt[point].r[d];
+    }
+  }
+  array_free(&src);
 
-  auto o_r = pool::o_scratch + byteOffset;
-  byteOffset += dim * pn * sizeof(dfloat);
+  if (plan.Nsend) {
+    plan.o_el = platform->device.malloc(el.size() * sizeof(dlong), el.data());
+    plan.o_r = platform->device.malloc(r.size() * sizeof(dfloat), r.data());
+  }
 
-  auto o_el = pool::o_scratch + byteOffset;
-  byteOffset += pn * sizeof(dlong);
+  plan.code = code_base;
+  plan.npt = npt;
+  plan.valid = true;
 
-  // pack host buffers
-  for (int point = 0; point < pn; ++point) {
-    for (int component = 0; component < dim; ++component) {
-      pool::r[dim * point + component] = spt[point].r[component];
-    }
-    pool::el[point] = spt[point].el;
+  if (timerLevel == TimerLevel::Detailed) {
+    platform->timer.toc(timerName + "setupEvalPlan");
   }
+}
 
-  o_r.copyFrom(pool::r, dim * pn * sizeof(dfloat));
-  o_el.copyFrom(pool::el, pn * sizeof(dlong));
+void findpts_t::packOwned(const int nFields, const int inputOffset, occa::memory &o_in, dfloat *buffer)
+{
+  auto &plan = this->evalPlan;
+  if (plan.Nsend == 0)
+    return;
 
-  if (timerLevel != TimerLevel::None) {
-    platform->timer.tic(timerName + "findptsLocalEvalInternal::localEvalKernel", 0);
+  const auto Nbytes = nFields * plan.Nsend * sizeof(dfloat);
+  if (plan.o_out.size() < Nbytes) {
+    if (plan.o_out.size())
+      plan.o_out.free();
+    plan.o_out = platform->device.malloc(Nbytes);
+    plan.h_out = platform->device.mallocHost(Nbytes);
   }
-  this->localEvalKernel(pn, nFields, inputOffset, outputOffset, o_el, o_r, o_in, o_out);
-  if (timerLevel != TimerLevel::None) {
-    platform->timer.toc(timerName + "findptsLocalEvalInternal::localEvalKernel");
+  this->localEvalKernel(plan.Nsend, nFields, inputOffset, plan.Nsend, plan.o_el, plan.o_r, o_in, plan.o_out);
+  plan.o_out.copyTo(plan.h_out.ptr(), Nbytes);
+
+  // field-major -> point-major so each neighbor gets a contiguous block
+  auto *h_out = (dfloat *)plan.h_out.ptr();
+  for (dlong point = 0; point < plan.Nsend; ++point) {
+    for (int field = 0; field < nFields; ++field) {
+      buffer[nFields * point + field] = h_out[point + plan.Nsend * field];
+    }
   }
+}
 
-  o_out.copyTo(pool::out, nFields * outputOffset * sizeof(dfloat));
+void findpts_t::postExchange(const int nFields,
+                             dfloat *sendBuffer,
+                             dfloat *recvBuffer,
+                             const int tag,
+                             std::vector<MPI_Request> &requests)
+{
+  auto &plan = this->evalPlan;
+
+  for (int i = 0; i < plan.recvRanks.size(); ++i) {
+    requests.emplace_back();
+    MPI_Irecv(recvBuffer,
+              nFields * plan.recvCounts[i],
+              MPI_DFLOAT,
+              plan.recvRanks[i],
+              tag,
+              this->planComm,
+              &requests.back());
+    recvBuffer += nFields * plan.recvCounts[i];
+  }
+
+  for (int i = 0; i < plan.sendRanks.size(); ++i) {
+    requests.emplace_back();
+    MPI_Isend(sendBuffer,
+              nFields * plan.sendCounts[i],
+              MPI_DFLOAT,
+              plan.sendRanks[i],
+              tag,
+              this->planComm,
+              &requests.back());
+    sendBuffer += nFields * plan.sendCounts[i];
+  }
+}
 
-  // unpack buffer
-  for (int point = 0; point < pn; ++point) {
+void findpts_t::unpackRemote(const int nFields, const int outputOffset, const dfloat *buffer, dfloat *out)
+{
+  auto &plan = this->evalPlan;
+  for (dlong i = 0; i < plan.recvIndex.size(); ++i) {
     for (int field = 0; field < nFields; ++field) {
-      opt[point].out[field] = pool::out[point + field * outputOffset];
+      out[plan.recvIndex[i] + outputOffset * field] = buffer[nFields * i + field];
     }
   }
+}
+
+void findpts_t::evalRemote(dfloat *out,
+                           const int *const code_base,
+                           const int *const proc_base,
+                           const int *const el_base,
+                           const dfloat *const r_base,
+                           const int npt,
+                           const int nFields,
+                           const int inputOffset,
+                           const int outputOffset,
+                           occa::memory &o_in)
+{
+  auto &plan = this->evalPlan;
+
+  // points are stationary between find/update calls, reuse the exchange plan
+  int stale = !plan.valid || plan.code != code_base || plan.npt != npt;
+  MPI_Allreduce(MPI_IN_PLACE, &stale, 1, MPI_INT, MPI_MAX, this->comm);
+  if (stale) {
+    setupEvalPlan(code_base, proc_base, el_base, r_base, npt);
+  }
+
+  if (timerLevel == TimerLevel::Detailed) {
+    platform->timer.tic(timerName + "evalRemote::localEvalKernel", 1);
+  }
+  plan.sendBuffer.resize(nFields * plan.Nsend);
+  packOwned(nFields, inputOffset, o_in, plan.sendBuffer.data());
   if (timerLevel == TimerLevel::Detailed) {
-    platform->timer.toc(timerName + "findptsLocalEvalInternal");
+    platform->timer.toc(timerName + "evalRemote::localEvalKernel");
+    platform->timer.tic(timerName + "evalRemote::exchange", 1);
+  }
+
+  plan.recvBuffer.resize(nFields * plan.recvIndex.size());
+  std::vector<MPI_Request> requests;
+  postExchange(nFields, plan.sendBuffer.data(), plan.recvBuffer.data(), 0, requests);
+  MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+
+  unpackRemote(nFields, outputOffset, plan.recvBuffer.data(), out);
+
+  if (timerLevel == TimerLevel::Detailed) {
+    platform->timer.toc(timerName + "evalRemote::exchange");
   }
 }
 
-template <typename OutputType>
 void findpts_t::findptsEvalImpl(occa::memory &o_out,
                                 const int *const code_base,
                                 const int *const proc_base,
@@ -446,9 +564,7 @@ void findpts_t::findptsEvalImpl(occa::memory &o_out,
                                 const int nFields,
                                 const int inputOffset,
                                 const int outputOffset,
-                                occa::memory &o_in,
-                                hashData_t &hash,
-                                crystal &cr)
+                                occa::memory &o_in)
 {
   if (timerLevel == TimerLevel::Detailed) {
     platform->timer.tic(timerName + "findptsEvalImpl", 1);
@@ -460,122 +576,27 @@ void findpts_t::findptsEvalImpl(occa::memory &o_out,
     out_base.resize(growthFactor * nFields * outputOffset);
   }
 
-  struct array src, outpt;
-  /* copy user data, weed out unfound points, send out */
-  if (timerLevel == TimerLevel::Detailed) {
-    platform->timer.tic(timerName + "findptsEvalImpl::copy data", 1);
-  }
-  // avoid doing SoA -> AoS conversion for points that remain on the same rank
-  {
-    int index;
-    const int *code = code_base, *proc = proc_base, *el = el_base;
-    const dfloat *r = r_base;
-
-    int numSend = 0;
-
-    if (timerLevel == TimerLevel::Detailed) {
-      platform->timer.tic(timerName + "findptsEvalImpl::copy data::count_num_send", 1);
-    }
-    for (index = 0; index < npt; ++index) {
-      numSend += (code_base[index] != CODE_NOT_FOUND && proc_base[index] != this->rank);
-    }
-    if (timerLevel == TimerLevel::Detailed) {
-      platform->timer.toc(timerName + "findptsEvalImpl::copy data::count_num_send");
-    }
-
-    evalSrcPt_t *pt;
-    array_init(evalSrcPt_t, &src, numSend);
-    pt = (evalSrcPt_t *)src.ptr;
-
-    int ctr = 0;
-
-    for (index = 0; index < npt; ++index) {
-      if (*code != CODE_NOT_FOUND && *proc != this->rank) {
-        for (int d = 0; d < dim; ++d) {
-          pt->r[d] = r[d];
-        }
-        pt->index = index;
-        pt->proc = *proc;
-        pt->el = *el;
-        ++pt;
-      }
-      r += dim;
-      code++;
-      proc++;
-      el++;
-    }
-
-    src.n = pt - (evalSrcPt_t *)src.ptr;
-    if (timerLevel == TimerLevel::Detailed) {
-      platform->timer.tic(timerName + "findptsEvalImpl::copy data::sarray_transfer", 1);
-    }
-    sarray_transfer(evalSrcPt_t, &src, proc, 1, &cr);
-    if (timerLevel == TimerLevel::Detailed) {
-      platform->timer.toc(timerName + "findptsEvalImpl::copy data::sarray_transfer");
-    }
-  }
-
-  if (timerLevel == TimerLevel::Detailed) {
-    platform->timer.toc(timerName + "findptsEvalImpl::copy data");
-    platform->timer.tic(timerName + "findptsEvalImpl::eval points", 1);
-  }
-
-  /* evaluate points, send back */
-  {
-    if (timerLevel == TimerLevel::Detailed) {
-      platform->timer.tic(timerName + "findptsEvalImpl::eval points::do allocation", 1);
-    }
-    int n = src.n;
-    const evalSrcPt_t *spt;
-    OutputType *opt;
-    array_init(OutputType, &outpt, n);
-    outpt.n = n;
-    spt = (evalSrcPt_t *)src.ptr;
-    opt = (OutputType *)outpt.ptr;
-    if (timerLevel == TimerLevel::Detailed) {
-      platform->timer.toc(timerName + "findptsEvalImpl::eval points::do allocation");
-    }
-
-    auto timerNameSave = timerName;
-    timerName = timerName + "findptsEvalImpl::eval points::";
-    findptsLocalEvalInternal(opt, spt, src.n, nFields, inputOffset, src.n, o_in);
-    timerName = timerNameSave;
-
-    if (timerLevel == TimerLevel::Detailed) {
-      platform->timer.tic(timerName + "findptsEvalImpl::eval points::copy index and proc", 1);
-    }
-    spt = (evalSrcPt_t *)src.ptr;
-    opt = (OutputType *)outpt.ptr;
-    for (; n; --n, ++spt, ++opt) {
-      opt->index = spt->index;
-      opt->proc = spt->proc;
-    }
-    array_free(&src);
-    if (timerLevel == TimerLevel::Detailed) {
-      platform->timer.toc(timerName + "findptsEvalImpl::eval points::copy index and proc");
-      platform->timer.tic(timerName + "findptsEvalImpl::eval points::sarray_transfer", 1);
-    }
-    sarray_transfer(OutputType, &outpt, proc, 1, &cr);
-    if (timerLevel == TimerLevel::Detailed) {
-      platform->timer.toc(timerName + "findptsEvalImpl::eval points::sarray_transfer");
-    }
-  }
+  /* evaluate points owned by other ranks and receive the results */
+  auto timerNameSave = timerName;
+  timerName = timerName + "findptsEvalImpl::";
+  evalRemote(out_base.data(),
+             code_base,
+             proc_base,
+             el_base,
+             r_base,
+             npt,
+             nFields,
+             inputOffset,
+             outputOffset,
+             o_in);
+  timerName = timerNameSave;
 
   if (timerLevel == TimerLevel::Detailed) {
-    platform->timer.toc(timerName + "findptsEvalImpl::eval points");
     platform->timer.tic(timerName + "findptsEvalImpl::copy results", 1);
   }
 
   /* copy results to user data */
   {
-    int n = outpt.n;
-    OutputType *opt = (OutputType *)outpt.ptr;
-
-    for (; n; --n, ++opt) {
-      for (int field = 0; field < nFields; ++field) {
-        out_base[opt->index + outputOffset * field] = opt->out[field];
-      }
-    }
     if (outputOffset)
       o_out.copyFrom(out_base.data(), nFields * outputOffset * sizeof(dfloat));
 
@@ -599,8 +620,6 @@ void findpts_t::findptsEvalImpl(occa::memory &o_out,
     if (timerLevel != TimerLevel::None) {
       platform->timer.toc(timerName + "findptsEvalImpl::localEvalKernel");
     }
-
-    array_free(&outpt);
   }
   if (timerLevel == TimerLevel::Detailed) {
     platform->timer.toc(timerName + "findptsEvalImpl::copy results");
@@ -608,7 +627,6 @@ void findpts_t::findptsEvalImpl(occa::memory &o_out,
   }
 }
 
-template <typename OutputType>
 void findpts_t::findptsEvalImpl(dfloat *out,
                                 const int *const code_base,
                                 const int *const proc_base,
@@ -618,9 +636,7 @@ void findpts_t::findptsEvalImpl(dfloat *out,
                                 const int nFields,
                                 const int inputOffset,
                                 const int outputOffset,
-                                const dfloat *const in,
-                                hashData_t &hash,
-                                crystal &cr)
+                                const dfloat *const in)
 {
   if (timerLevel == TimerLevel::Detailed) {
     platform->timer.tic(timerName + "findptsEvalImpl", 1);
@@ -636,6 +652,8 @@ void findpts_t::findptsEvalImpl(dfloat *out,
       constexpr int growthFactor = 2;
       o_in = platform->device.malloc(growthFactor * Nbytes);
     }
+    if (Nbytes)
+      o_in.copyFrom(in, Nbytes);
   }
 
   {
@@ -647,141 +665,37 @@ void findpts_t::findptsEvalImpl(dfloat *out,
     }
   }
 
-  struct array src, outpt;
-  /* copy user data, weed out unfound points, send out */
-  if (timerLevel == TimerLevel::Detailed) {
-    platform->timer.tic(timerName + "findptsEvalImpl::copy data", 1);
-  }
-  // avoid doing SoA -> AoS conversion for points that remain on the same rank
-  {
-    int index;
-    const int *code = code_base, *proc = proc_base, *el = el_base;
-    const dfloat *r = r_base;
-
-    int numSend = 0;
-
-    if (timerLevel == TimerLevel::Detailed) {
-      platform->timer.tic(timerName + "findptsEvalImpl::copy data::count_num_send", 1);
-    }
-    for (index = 0; index < npt; ++index) {
-      numSend += (code_base[index] != CODE_NOT_FOUND && proc_base[index] != this->rank);
-    }
-    if (timerLevel == TimerLevel::Detailed) {
-      platform->timer.toc(timerName + "findptsEvalImpl::copy data::count_num_send");
-    }
-
-    evalSrcPt_t *pt;
-    array_init(evalSrcPt_t, &src, numSend);
-    pt = (evalSrcPt_t *)src.ptr;
-
-    int ctr = 0;
-
-    for (index = 0; index < npt; ++index) {
-      if (*code != CODE_NOT_FOUND && *proc != this->rank) {
-        for (int d = 0; d < dim; ++d) {
-          pt->r[d] = r[d];
-        }
-        pt->index = index;
-        pt->proc = *proc;
-        pt->el = *el;
-        ++pt;
-      }
-      r += dim;
-      code++;
-      proc++;
-      el++;
-    }
-
-    src.n = pt - (evalSrcPt_t *)src.ptr;
-    if (timerLevel == TimerLevel::Detailed) {
-      platform->timer.tic(timerName + "findptsEvalImpl::copy data::sarray_transfer", 1);
-    }
-    sarray_transfer(evalSrcPt_t, &src, proc, 1, &cr);
-    if (timerLevel == TimerLevel::Detailed) {
-      platform->timer.toc(timerName + "findptsEvalImpl::copy data::sarray_transfer");
-    }
-  }
-
-  if (timerLevel == TimerLevel::Detailed) {
-    platform->timer.toc(timerName + "findptsEvalImpl::copy data");
-    platform->timer.tic(timerName + "findptsEvalImpl::eval points", 1);
+  // launch local eval kernel on all points that can be evaluated on the current rank
+  if (timerLevel != TimerLevel::None) {
+    platform->timer.tic(timerName + "findptsEvalImpl::localEvalKernel", 1);
   }
-
-  /* evaluate points, send back */
-  {
-    int n = src.n;
-    const evalSrcPt_t *spt;
-    OutputType *opt;
-    array_init(OutputType, &outpt, n);
-    outpt.n = n;
-    spt = (evalSrcPt_t *)src.ptr;
-    opt = (OutputType *)outpt.ptr;
-
-    auto timerNameSave = timerName;
-    timerName = timerName + "findptsEvalImpl::eval points::";
-    findptsLocalEvalInternal(opt, spt, src.n, nFields, inputOffset, src.n, o_in);
-    timerName = timerNameSave;
-
-    spt = (evalSrcPt_t *)src.ptr;
-    opt = (OutputType *)outpt.ptr;
-    for (; n; --n, ++spt, ++opt) {
-      opt->index = spt->index;
-      opt->proc = spt->proc;
-    }
-    array_free(&src);
-    if (timerLevel == TimerLevel::Detailed) {
-      platform->timer.tic(timerName + "findptsEvalImpl::eval points::sarray_transfer", 1);
-    }
-    sarray_transfer(OutputType, &outpt, proc, 1, &cr);
-    if (timerLevel == TimerLevel::Detailed) {
-      platform->timer.toc(timerName + "findptsEvalImpl::eval points::sarray_transfer");
-    }
+  if (npt > 0) {
+    this->localEvalMaskKernel(npt,
+                              nFields,
+                              inputOffset,
+                              outputOffset,
+                              this->rank,
+                              this->o_proc,
+                              this->o_code,
+                              this->o_el,
+                              this->o_r,
+                              o_in,
+                              o_out);
   }
-
-  if (timerLevel == TimerLevel::Detailed) {
-    platform->timer.toc(timerName + "findptsEvalImpl::eval points");
-    platform->timer.tic(timerName + "findptsEvalImpl::copy results", 1);
+  if (timerLevel != TimerLevel::None) {
+    platform->timer.toc(timerName + "findptsEvalImpl::localEvalKernel");
   }
 
-  /* copy results to user data */
-  {
-    int n = outpt.n;
-    OutputType *opt = (OutputType *)outpt.ptr;
+  if (outputOffset)
+    o_out.copyTo(out, nFields * outputOffset * sizeof(dfloat));
 
-    // launch local eval kernel on all points that can be evaluated on the current rank
-    if (timerLevel != TimerLevel::None) {
-      platform->timer.tic(timerName + "findptsEvalImpl::localEvalKernel", 1);
-    }
-    if (npt > 0) {
-      this->localEvalMaskKernel(npt,
-                                nFields,
-                                inputOffset,
-                                outputOffset,
-                                this->rank,
-                                this->o_proc,
-                                this->o_code,
-                                this->o_el,
-                                this->o_r,
-                                o_in,
-                                o_out);
-    }
-    if (timerLevel != TimerLevel::None) {
-      platform->timer.toc(timerName + "findptsEvalImpl::localEvalKernel");
-    }
-
-    if (outputOffset)
-      o_out.copyTo(out, nFields * outputOffset * sizeof(dfloat));
-
-    for (; n; --n, ++opt) {
-      for (int field = 0; field < nFields; ++field) {
-        out[opt->index + outputOffset * field] = opt->out[field];
-      }
-    }
+  /* evaluate points owned by other ranks and receive the results */
+  auto timerNameSave = timerName;
+  timerName = timerName + "findptsEvalImpl::";
+  evalRemote(out, code_base, proc_base, el_base, r_base, npt, nFields, inputOffset, outputOffset, o_in);
+  timerName = timerNameSave;
 
-    array_free(&outpt);
-  }
   if (timerLevel == TimerLevel::Detailed) {
-    platform->timer.toc(timerName + "findptsEvalImpl::copy results");
     platform->timer.toc(timerName + "findptsEvalImpl");
   }
 }
@@ -834,6 +748,7 @@ findpts_t::findpts_t(MPI_Comm comm,
 
   this->comm = comm;
   MPI_Comm_rank(comm, &this->rank);
+  MPI_Comm_dup(comm, &this->planComm);
 
   this->tol = findptsData->local.tol;
   this->hash = &findptsData->hash;
@@ -921,6 +836,17 @@ findpts_t::~findpts_t()
 {
   auto *findptsData = (findpts_data_3 *)this->_findptsData;
   findpts_free_3(findptsData);
+
+  int finalized;
+  MPI_Finalized(&finalized);
+  if (!finalized) {
+    for (auto &&pending : {&pendingSends, &pendingRecvs}) {
+      for (auto &&exchange : *pending) {
+        MPI_Waitall(exchange.requests.size(), exchange.requests.data(), MPI_STATUSES_IGNORE);
+      }
+    }
+    MPI_Comm_free(&this->planComm);
+  }
 }
 
 static slong lfloor(dfloat x) { return floor(x); }
@@ -959,6 +885,7 @@ void findpts_t::find(data_t *const findPtsData,
   if (timerLevel != TimerLevel::None) {
     platform->timer.tic(timerName + "find", 1);
   }
+  this->evalPlan.valid = false;
 
   static std::vector<dfloat> x_base;
   static std::vector<dfloat> y_base;
@@ -1277,6 +1204,7 @@ void findpts_t::find(data_t *const findPtsData,
   if (timerLevel != TimerLevel::None) {
     platform->timer.tic(timerName + "find", 1);
   }
+  this->evalPlan.valid = false;
   static std::vector<int> codeArr;
   static std::vector<int> elArr;
   static std::vector<dfloat> rArr;
@@ -1589,30 +1517,22 @@ void findpts_t::eval(const dlong npt,
   const auto timerNameSave = timerName;
   timerName = timerName + "eval::";
 
-  auto fieldSizesTuple = n_tuple<int, findpts_t::maxFields>{};
-  tuple_for_each(fieldSizesTuple, [&](auto T) {
-    if (nFields != decltype(T)::value)
-      return;
-    findptsEvalImpl<evalOutPt_t<decltype(T)::value>>(o_out,
-                                                     findPtsData->code_base,
-                                                     findPtsData->proc_base,
-                                                     findPtsData->el_base,
-                                                     findPtsData->r_base,
-                                                     npt,
-                                                     nFields,
-                                                     inputOffset,
-                                                     outputOffset,
-                                                     o_in,
-                                                     *this->hash,
-                                                     *this->cr);
-  });
-
-  nrsCheck(nFields < 1 || nFields > findpts_t::maxFields,
+  nrsCheck(nFields < 1,
            platform->comm.mpiComm,
            EXIT_FAILURE,
-           "Error: nFields = %d is not supported. nFields must be between 1 and %d.",
-           nFields,
-           findpts_t::maxFields);
+           "Error: nFields = %d is not supported. nFields must be at least 1.",
+           nFields);
+
+  findptsEvalImpl(o_out,
+                  findPtsData->code_base,
+                  findPtsData->proc_base,
+                  findPtsData->el_base,
+                  findPtsData->r_base,
+                  npt,
+                  nFields,
+                  inputOffset,
+                  outputOffset,
+                  o_in);
 
   timerName = timerNameSave;
 
@@ -1635,30 +1555,22 @@ void findpts_t::eval(const dlong npt,
 
   const auto timerNameSave = timerName;
   timerName = timerName + "eval::";
-  auto fieldSizesTuple = n_tuple<int, findpts_t::maxFields>{};
-  tuple_for_each(fieldSizesTuple, [&](auto T) {
-    if (nFields != decltype(T)::value)
-      return;
-    findptsEvalImpl<evalOutPt_t<decltype(T)::value>>(out,
-                                                     findPtsData->code_base,
-                                                     findPtsData->proc_base,
-                                                     findPtsData->el_base,
-                                                     findPtsData->r_base,
-                                                     npt,
-                                                     nFields,
-                                                     inputOffset,
-                                                     outputOffset,
-                                                     in,
-                                                     *this->hash,
-                                                     *this->cr);
-  });
-
-  nrsCheck(nFields < 1 || nFields > findpts_t::maxFields,
+  nrsCheck(nFields < 1,
            platform->comm.mpiComm,
            EXIT_FAILURE,
-           "Error: nFields = %d is not supported. nFields must be between 1 and %d.",
-           nFields,
-           findpts_t::maxFields);
+           "Error: nFields = %d is not supported. nFields must be at least 1.",
+           nFields);
+
+  findptsEvalImpl(out,
+                  findPtsData->code_base,
+                  findPtsData->proc_base,
+                  findPtsData->el_base,
+                  findPtsData->r_base,
+                  npt,
+                  nFields,
+                  inputOffset,
+                  outputOffset,
+                  in);
 
   timerName = timerNameSave;
 
@@ -1667,10 +1579,112 @@ void findpts_t::eval(const dlong npt,
   }
 }
 
+void findpts_t::evalStart(const dlong npt,
+                          const dlong nFields,
+                          const dlong inputOffset,
+                          occa::memory o_in,
+                          data_t *findPtsData)
+{
+  auto &plan = this->evalPlan;
+
+  // no collective here, the plan has to exist already
+  nrsCheck(!plan.valid || plan.code != findPtsData->code_base || plan.npt != npt,
+           MPI_COMM_SELF,
+           EXIT_FAILURE,
+           "%s\n",
+           "evalStart requires a previous eval on the same points!");
+
+  if (timerLevel != TimerLevel::None) {
+    platform->timer.tic(timerName + "evalStart", 1);
+  }
+
+  // keep at most one older exchange in flight
+  while (pendingSends.size() > 1) {
+    auto &send = pendingSends.front();
+    MPI_Waitall(send.requests.size(), send.requests.data(), MPI_STATUSES_IGNORE);
+    pendingSends.pop_front();
+  }
+
+  pendingSends.emplace_back();
+  auto &send = pendingSends.back();
+  send.nFields = nFields;
+  send.buffer.resize(nFields * plan.Nsend);
+  packOwned(nFields, inputOffset, o_in, send.buffer.data());
+
+  pendingRecvs.emplace_back();
+  auto &recv = pendingRecvs.back();
+  recv.nFields = nFields;
+  recv.buffer.resize(nFields * plan.recvIndex.size());
+
+  std::vector<MPI_Request> requests;
+  postExchange(nFields, send.buffer.data(), recv.buffer.data(), asyncTag, requests);
+  const auto Nrecv = plan.recvRanks.size();
+  recv.requests.assign(requests.begin(), requests.begin() + Nrecv);
+  send.requests.assign(requests.begin() + Nrecv, requests.end());
+
+  if (timerLevel != TimerLevel::None) {
+    platform->timer.toc(timerName + "evalStart");
+  }
+}
+
+void findpts_t::evalFinish(const dlong npt,
+                           const dlong nFields,
+                           const dlong inputOffset,
+                           const dlong outputOffset,
+                           occa::memory o_in,
+                           data_t *findPtsData,
+                           occa::memory o_out)
+{
+  nrsCheck(pendingRecvs.empty() || pendingRecvs.front().nFields != nFields,
+           MPI_COMM_SELF,
+           EXIT_FAILURE,
+           "%s\n",
+           "evalFinish does not match an outstanding evalStart!");
+
+  if (timerLevel != TimerLevel::None) {
+    platform->timer.tic(timerName + "evalFinish", 1);
+  }
+
+  static std::vector<dfloat> out_base;
+  if (out_base.size() < nFields * outputOffset) {
+    constexpr int growthFactor = 2;
+    out_base.resize(growthFactor * nFields * outputOffset);
+  }
+
+  auto &recv = pendingRecvs.front();
+  MPI_Waitall(recv.requests.size(), recv.requests.data(), MPI_STATUSES_IGNORE);
+  unpackRemote(nFields, outputOffset, recv.buffer.data(), out_base.data());
+  pendingRecvs.pop_front();
+
+  if (outputOffset)
+    o_out.copyFrom(out_base.data(), nFields * outputOffset * sizeof(dfloat));
+
+  // points owned by this rank use the current input
+  if (npt > 0) {
+    this->localEvalMaskKernel(npt,
+                              nFields,
+                              inputOffset,
+                              outputOffset,
+                              this->rank,
+                              this->o_proc,
+                              this->o_code,
+                              this->o_el,
+                              this->o_r,
+                              o_in,
+                              o_out);
+  }
+
+  if (timerLevel != TimerLevel::None) {
+    platform->timer.toc(timerName + "evalFinish");
+  }
+}
+
 crystal *findpts_t::crystalRouter() { return this->cr; }
 
 void findpts_t::update(data_t &data)
 {
+  this->evalPlan.valid = false;
+
   auto npt = data.code.size();
   if (npt == 0)
     return;
@@ -3,6 +3,7 @@
 
 #include "occa.hpp"
 #include <mpi.h>
+#include <deque>
 #include <limits>
 #include <tuple>
 #include <vector>
@@ -109,6 +110,20 @@ public:
             data_t *findPtsData,
             dfloat *out);
 
+  // Split-phase eval for lagged coupling. evalStart() sends the values of the
+  // points this rank evaluates for others, evalFinish() completes the oldest
+  // outstanding evalStart() and writes its results to o_out. Both are local
+  // (no collectives) and require an eval() on the same points beforehand.
+  void evalStart(const dlong npt, const dlong nFields, const dlong inputOffset, occa::memory o_in, data_t *findPtsData);
+
+  void evalFinish(const dlong npt,
+                  const dlong nFields,
+                  const dlong inputOffset,
+                  const dlong outputOffset,
+                  occa::memory o_in,
+                  data_t *findPtsData,
+                  occa::memory o_out);
+
   // set timer level
   void setTimerLevel(TimerLevel level) { timerLevel = level; }
   TimerLevel getTimerLevel() const { return timerLevel; }
@@ -125,8 +140,6 @@ public:
   void update(data_t &data);
 
 private:
-  static constexpr int maxFields = 30;
-
   MPI_Comm comm;
   int rank;
   TimerLevel timerLevel = TimerLevel::None;
@@ -190,7 +203,6 @@ private:
                     occa::memory o_zint,
                     const int pn);
 
-  template <typename OutputType>
   void findptsEvalImpl(dfloat *out,
                        const int *const code_base,
                        const int *const proc_base,
@@ -200,11 +212,8 @@ private:
                        const int nFields,
                        const int inputOffset,
                        const int outputOffset,
-                       const dfloat *const in,
-                       hashData_t &hash,
-                       crystal &cr);
+                       const dfloat *const in);
 
-  template <typename OutputType>
   void findptsEvalImpl(occa::memory &o_out,
                        const int *const code_base,
                        const int *const proc_base,
@@ -214,18 +223,73 @@ private:
                        const int nFields,
                        const int inputOffset,
                        const int outputOffset,
-                       occa::memory &o_in,
-                       hashData_t &hash,
-                       crystal &cr);
-
-  template <typename OutputType>
-  void findptsLocalEvalInternal(OutputType *opt,
-                                const evalSrcPt_t *spt,
-                                const int pn,
-                                const int nFields,
-                                const int inputOffset,
-                                const int outputOffset,
-                                occa::memory &o_in);
+                       occa::memory &o_in);
+
+  // Exchange plan for points located on other ranks, built on the first
+  // eval() after find()/update() and reused while the points are unchanged.
+  // The owners keep the (el, r) of the points they evaluate for others, so an
+  // eval() is one interpolation kernel plus one point-to-point exchange.
+  struct evalPlan_t {
+    bool valid = false;
+    const int *code = nullptr;
+    int npt = 0;
+
+    // points other ranks requested from this rank
+    dlong Nsend = 0;
+    std::vector<int> sendRanks;
+    std::vector<int> sendCounts;
+    occa::memory o_el;
+    occa::memory o_r;
+    occa::memory o_out;
+    occa::memory h_out;
+    std::vector<dfloat> sendBuffer;
+
+    // local points evaluated on other ranks
+    std::vector<int> recvRanks;
+    std::vector<int> recvCounts;
+    std::vector<dlong> recvIndex;
+    std::vector<dfloat> recvBuffer;
+  };
+
+  evalPlan_t evalPlan;
+  MPI_Comm planComm;
+
+  // exchanges posted by evalStart()
+  struct pendingExchange_t {
+    int nFields;
+    std::vector<dfloat> buffer;
+    std::vector<MPI_Request> requests;
+  };
+  static constexpr int asyncTag = 1;
+  std::deque<pendingExchange_t> pendingSends;
+  std::deque<pendingExchange_t> pendingRecvs;
+
+  void packOwned(const int nFields, const int inputOffset, occa::memory &o_in, dfloat *buffer);
+
+  void postExchange(const int nFields,
+                    dfloat *sendBuffer,
+                    dfloat *recvBuffer,
+                    const int tag,
+                    std::vector<MPI_Request> &requests);
+
+  void unpackRemote(const int nFields, const int outputOffset, const dfloat *buffer, dfloat *out);
+
+  void setupEvalPlan(const int *const code_base,
+                     const int *const proc_base,
+                     const int *const el_base,
+                     const dfloat *const r_base,
+                     const int npt);
+
+  void evalRemote(dfloat *out,
+                  const int *const code_base,
+                  const int *const proc_base,
+                  const int *const el_base,
+                  const dfloat *const r_base,
+                  const int npt,
+                  const int nFields,
+                  const int inputOffset,
+                  const int outputOffset,
+                  occa::memory &o_in);
 };
 
 } // namespace findpts
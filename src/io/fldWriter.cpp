@@ -0,0 +1,421 @@
+#include <thread>
+#include <map>
+#include "nrs.hpp"
+#include "fldWriter.hpp"
+#include "nekInterfaceAdapter.hpp"
+
+namespace
+{
+
+constexpr int headerBytes = 132;
+constexpr float testPattern = 6.54321;
+
+struct fieldGroup_t {
+  int Ncomp;
+  size_t offset;                    // into staging buffer (in words)
+  std::vector<occa::memory> o_comp; // device source of each component
+  std::vector<dlong> Ncopy;         // number of (non-padded) words of each component
+};
+
+struct job_t {
+  std::string fileName;
+  std::string header;
+  int wdsize;
+  int step;
+  std::vector<fieldGroup_t> groups;
+  bool staged; // all groups have been staged upfront (async)
+};
+
+nrs_t *nrs = nullptr;
+MPI_Comm ioComm = MPI_COMM_NULL;
+bool asyncEnabled = false;
+
+dlong Nelements = 0;
+int Nq = 0;
+int Np = 0;
+hlong nelgt = 0;
+hlong nelB = 0;
+std::vector<int> globalElementIds;
+
+std::map<std::string, int> fileCounter;
+
+occa::memory h_staging;
+std::vector<char> writeBuffer;
+std::vector<float> metaBuffer;
+std::thread ioThread;
+
+// Fortran Ew.d (scale=0) or 1PEw.d (scale=1) edit descriptor
+std::string fortranExp(double val, int width, int digits, int scale)
+{
+  char buf[64];
+  if (scale) {
+    snprintf(buf, sizeof(buf), "%.*E", digits, val);
+  }
+  else {
+    char tmp[64];
+    snprintf(tmp, sizeof(tmp), "%.*E", digits - 1, std::abs(val));
+    const std::string s(tmp);
+    const auto ePos = s.find('E');
+    std::string mantissa = s.substr(0, 1) + s.substr(2, ePos - 2);
+    int exponent = std::stoi(s.substr(ePos + 1)) + 1;
+    if (val == 0)
+      exponent = 0;
+    snprintf(buf,
+             sizeof(buf),
+             "%s0.%sE%c%02d",
+             (val < 0) ? "-" : "",
+             mantissa.c_str(),
+             (exponent < 0) ? '-' : '+',
+             std::abs(exponent));
+  }
+
+  std::string out(buf);
+  if (out.length() < width)
+    out.insert(0, width - out.length(), ' ');
+  return out;
+}
+
+std::string header(int wdsize, double t, int step, const std::string &rdcode, double p0th)
+{
+  char buf[headerBytes + 1];
+  snprintf(buf,
+           sizeof(buf),
+           "#std %1d %2d %2d %2d %10lld %10lld %s %9d %6d %6d %-10s%s %c",
+           wdsize,
+           Nq,
+           Nq,
+           Nq,
+           nelgt,
+           nelgt,
+           fortranExp(t, 20, 13, 0).c_str(),
+           step,
+           0,
+           1,
+           rdcode.c_str(),
+           fortranExp(p0th, 15, 7, 1).c_str(),
+           'F');
+
+  std::string hdr(buf);
+  hdr.resize(headerBytes, ' ');
+  return hdr;
+}
+
+void setupPartition()
+{
+  if (globalElementIds.size())
+    return;
+
+  auto mesh = nrs->_mesh;
+  Nelements = mesh->Nelements;
+  Nq = mesh->Nq;
+  Np = mesh->Np;
+
+  globalElementIds.resize(Nelements);
+  for (int e = 0; e < Nelements; e++)
+    globalElementIds[e] = nek::lglel(e) + 1;
+
+  hlong Nlocal = Nelements;
+  MPI_Allreduce(&Nlocal, &nelgt, 1, MPI_HLONG, MPI_SUM, platform->comm.mpiComm);
+  MPI_Exscan(&Nlocal, &nelB, 1, MPI_HLONG, MPI_SUM, platform->comm.mpiComm);
+  if (platform->comm.mpiRank == 0)
+    nelB = 0;
+}
+
+template <typename T> void packGroup(const fieldGroup_t &group, const dfloat *staging)
+{
+  const size_t Nlocal = static_cast<size_t>(Nelements) * Np;
+  writeBuffer.resize(group.Ncomp * Nlocal * sizeof(T));
+  auto out = reinterpret_cast<T *>(writeBuffer.data());
+
+#pragma omp parallel for
+  for (dlong e = 0; e < Nelements; e++) {
+    for (int c = 0; c < group.Ncomp; c++) {
+      const dfloat *in = staging + group.offset + c * Nlocal + e * Np;
+      T *outElement = out + (static_cast<size_t>(e) * group.Ncomp + c) * Np;
+      for (int n = 0; n < Np; n++)
+        outElement[n] = static_cast<T>(in[n]);
+    }
+  }
+}
+
+// per element min/max of a group is stored at metaOffset (in floats)
+void packMetaData(const fieldGroup_t &group, const dfloat *staging, size_t metaOffset)
+{
+  const size_t Nlocal = static_cast<size_t>(Nelements) * Np;
+  auto out = metaBuffer.data() + metaOffset;
+
+#pragma omp parallel for
+  for (dlong e = 0; e < Nelements; e++) {
+    for (int c = 0; c < group.Ncomp; c++) {
+      const dfloat *in = staging + group.offset + c * Nlocal + e * Np;
+      const auto [min, max] = std::minmax_element(in, in + Np);
+      out[2 * (e * group.Ncomp + c) + 0] = *min;
+      out[2 * (e * group.Ncomp + c) + 1] = *max;
+    }
+  }
+}
+
+void stageGroup(const fieldGroup_t &group, dfloat *staging)
+{
+  const size_t Nlocal = static_cast<size_t>(Nelements) * Np;
+  for (int c = 0; c < group.Ncomp; c++) {
+    dfloat *out = staging + c * Nlocal;
+    // fields living on the fluid mesh only are padded with zeros
+    group.o_comp[c].copyTo(out, group.Ncopy[c] * sizeof(dfloat));
+    std::fill(out + group.Ncopy[c], out + Nlocal, 0);
+  }
+}
+
+void writeJob(const job_t job, dfloat *staging)
+{
+  const double tStart = MPI_Wtime();
+
+  int rank;
+  MPI_Comm_rank(ioComm, &rank);
+
+  MPI_File fh;
+  int err = MPI_File_open(ioComm,
+                          job.fileName.c_str(),
+                          MPI_MODE_CREATE | MPI_MODE_WRONLY,
+                          MPI_INFO_NULL,
+                          &fh);
+  nrsCheck(err != MPI_SUCCESS, MPI_COMM_SELF, EXIT_FAILURE, "Cannot open %s!\n", job.fileName.c_str());
+  MPI_File_set_size(fh, 0);
+
+  if (rank == 0) {
+    MPI_File_write_at(fh, 0, job.header.c_str(), headerBytes, MPI_BYTE, MPI_STATUS_IGNORE);
+    MPI_File_write_at(fh, headerBytes, &testPattern, 1, MPI_FLOAT, MPI_STATUS_IGNORE);
+  }
+
+  MPI_Offset offs0 = headerBytes + sizeof(float);
+  MPI_File_write_at_all(fh,
+                        offs0 + nelB * sizeof(int),
+                        globalElementIds.data(),
+                        Nelements,
+                        MPI_INT,
+                        MPI_STATUS_IGNORE);
+  offs0 += nelgt * sizeof(int);
+
+  // one record holds all GLL points of an element component
+  MPI_Datatype recordType;
+  MPI_Type_contiguous(Np * job.wdsize, MPI_BYTE, &recordType);
+  MPI_Type_commit(&recordType);
+
+  int Ncomp = 0;
+  for (const auto &group : job.groups)
+    Ncomp += group.Ncomp;
+  metaBuffer.resize(2 * Ncomp * Nelements);
+
+  const MPI_Offset stride = nelgt * Np * job.wdsize;
+  const MPI_Offset strideB = nelB * Np * job.wdsize;
+  int ioflds = 0;
+  for (auto group : job.groups) {
+    // without upfront staging only a single group is held on the host at a time
+    if (!job.staged) {
+      stageGroup(group, staging);
+      group.offset = 0;
+    }
+
+    if (job.wdsize == sizeof(double))
+      packGroup<double>(group, staging);
+    else
+      packGroup<float>(group, staging);
+    packMetaData(group, staging, 2 * ioflds * Nelements);
+
+    const MPI_Offset offs = offs0 + ioflds * stride + group.Ncomp * strideB;
+    MPI_File_write_at_all(fh,
+                          offs,
+                          writeBuffer.data(),
+                          group.Ncomp * Nelements,
+                          recordType,
+                          MPI_STATUS_IGNORE);
+    ioflds += group.Ncomp;
+  }
+  MPI_Type_free(&recordType);
+
+  // per element min/max (single precision) appended at the end of the file
+  offs0 += ioflds * stride;
+  ioflds = 0;
+  for (const auto &group : job.groups) {
+    const MPI_Offset offs = offs0 + ioflds * nelgt * 2 * sizeof(float) + group.Ncomp * nelB * 2 * sizeof(float);
+    MPI_File_write_at_all(fh,
+                          offs,
+                          metaBuffer.data() + 2 * ioflds * Nelements,
+                          2 * group.Ncomp * Nelements,
+                          MPI_FLOAT,
+                          MPI_STATUS_IGNORE);
+    ioflds += group.Ncomp;
+  }
+
+  MPI_Offset fileSize;
+  MPI_File_get_size(fh, &fileSize);
+  MPI_File_close(&fh);
+
+  double tio = MPI_Wtime() - tStart;
+  MPI_Allreduce(MPI_IN_PLACE, &tio, 1, MPI_DOUBLE, MPI_MAX, ioComm);
+
+  if (rank == 0) {
+    printf("\n%9d done :: Write checkpoint %s\n", job.step, job.fileName.c_str());
+    printf("%30sfile size = %.2f GB\n", "", fileSize / 1e9);
+    printf("%30savg data-throughput = %.1f GB/s\n\n", "", fileSize / 1e9 / tio);
+    fflush(stdout);
+  }
+}
+
+} // namespace
+
+namespace fld
+{
+
+void setup(nrs_t *nrs_)
+{
+  nrs = nrs_;
+
+  MPI_Comm_dup(platform->comm.mpiComm, &ioComm);
+
+  asyncEnabled = platform->options.compareArgs("CHECKPOINT ASYNC", "TRUE");
+  if (asyncEnabled) {
+    int provided;
+    MPI_Query_thread(&provided);
+    if (provided < MPI_THREAD_MULTIPLE) {
+      asyncEnabled = false;
+      if (platform->comm.mpiRank == 0)
+        std::cout << "async checkpointing disabled (requires NEKRS_MPI_THREAD_MULTIPLE=1)\n";
+    }
+  }
+}
+
+void write(const std::string &suffix,
+           double t,
+           int step,
+           int outXYZ,
+           int FP64,
+           const occa::memory &o_u,
+           const occa::memory &o_p,
+           const occa::memory &o_s,
+           int NSfields)
+{
+  nrsCheck(!nrs, MPI_COMM_SELF, EXIT_FAILURE, "%s\n", "fld::setup() has not been called!");
+
+  // staging buffer and writeBuffer are shared with an outstanding write
+  wait();
+
+  platform->timer.tic("checkpointing", 1);
+
+  setupPartition();
+
+  const auto counter = ++fileCounter[suffix];
+  if (suffix.empty() && counter == 1)
+    outXYZ = 1;
+
+  auto meshT = nrs->_mesh;
+  auto meshV = nrs->meshV;
+  const size_t Nlocal = static_cast<size_t>(Nelements) * Np;
+
+  job_t job;
+  job.wdsize = (FP64) ? sizeof(double) : sizeof(float);
+  job.step = step;
+  job.staged = asyncEnabled;
+
+  std::string rdcode;
+  int Nwords = 0;
+  auto addGroup = [&](int Ncomp) {
+    job.groups.push_back({Ncomp, Nwords * Nlocal});
+    Nwords += Ncomp;
+  };
+  auto addComp = [&](const occa::memory &o_fld, const mesh_t *mesh) {
+    job.groups.back().o_comp.push_back(o_fld);
+    job.groups.back().Ncopy.push_back(mesh->Nlocal);
+  };
+
+  if (outXYZ) {
+    rdcode += "X";
+    addGroup(3);
+    addComp(meshT->o_x, meshT);
+    addComp(meshT->o_y, meshT);
+    addComp(meshT->o_z, meshT);
+  }
+  if (o_u.ptr()) {
+    rdcode += "U";
+    addGroup(3);
+    for (int i = 0; i < nrs->NVfields; i++)
+      addComp(o_u + i * nrs->fieldOffset * sizeof(dfloat), meshV);
+  }
+  if (o_p.ptr()) {
+    rdcode += "P";
+    addGroup(1);
+    addComp(o_p, meshV);
+  }
+  if (o_s.ptr() && NSfields) {
+    rdcode += "T";
+    if (NSfields > 1)
+      rdcode += "S" + std::to_string((NSfields - 1) / 10) + std::to_string((NSfields - 1) % 10);
+    for (int is = 0; is < NSfields; is++) {
+      addGroup(1);
+      addComp(o_s + is * nrs->fieldOffset * sizeof(dfloat), (is) ? meshV : meshT);
+    }
+  }
+
+  // async writes need a snapshot of all fields, otherwise a single group is staged at a time
+  size_t NstagingWords = 1;
+  for (const auto &group : job.groups)
+    NstagingWords = std::max(NstagingWords, static_cast<size_t>(group.Ncomp));
+  if (job.staged)
+    NstagingWords = std::max(static_cast<size_t>(Nwords), size_t(1));
+
+  const size_t Nbytes = NstagingWords * Nlocal * sizeof(dfloat);
+  if (h_staging.size() < Nbytes) {
+    if (h_staging.size())
+      h_staging.free();
+    h_staging = platform->device.mallocHost(Nbytes);
+  }
+  auto staging = h_staging.ptr<dfloat>();
+
+  if (job.staged) {
+    // the io thread must not hold references to device memory
+    for (auto &group : job.groups) {
+      stageGroup(group, staging + group.offset);
+      group.o_comp.clear();
+    }
+  }
+
+  {
+    std::string casename;
+    platform->options.getArgs("CASENAME", casename);
+    std::ostringstream fileName;
+    fileName << suffix << casename << "0.f" << std::setw(5) << std::setfill('0') << counter;
+    job.fileName = fileName.str();
+  }
+  job.header = header(job.wdsize, t, step, rdcode, nrs->p0th[0]);
+
+  if (asyncEnabled) {
+    ioThread = std::thread(writeJob, job, staging);
+  }
+  else {
+    writeJob(job, staging);
+  }
+
+  platform->timer.toc("checkpointing");
+}
+
+void wait()
+{
+  if (ioThread.joinable()) {
+    platform->timer.tic("checkpointing", 1);
+    ioThread.join();
+    platform->timer.toc("checkpointing");
+  }
+}
+
+void finalize()
+{
+  wait();
+
+  if (h_staging.size())
+    h_staging.free();
+  if (ioComm != MPI_COMM_NULL)
+    MPI_Comm_free(&ioComm);
+  nrs = nullptr;
+}
+
+} // namespace fld
@@ -0,0 +1,28 @@
+#if !defined(nekrs_fldwriter_hpp_)
+#define nekrs_fldwriter_hpp_
+
+#include "nrs.hpp"
+
+// native (MPI-IO) writer for Nek5000 field files (.f%05d)
+namespace fld
+{
+void setup(nrs_t *nrs);
+
+// collective, returns after device fields have been staged if async is enabled
+void write(const std::string &suffix,
+           double t,
+           int step,
+           int outXYZ,
+           int FP64,
+           const occa::memory &o_u,
+           const occa::memory &o_p,
+           const occa::memory &o_s,
+           int NSfields);
+
+// block until all outstanding (async) writes have been completed
+void wait();
+
+void finalize();
+} // namespace fld
+
+#endif
@@ -3,8 +3,15 @@
 
 #include "nrs.hpp"
 
-namespace re2 
+namespace re2
 {
+
+struct header_t {
+  int nelgt;
+  int nelgv;
+};
+
+header_t header(const std::string& meshFile, MPI_Comm comm);
 void nelg(const std::string& meshFile, int& nelgt, int& nelgv, MPI_Comm comm);
 }
 
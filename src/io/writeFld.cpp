@@ -1,17 +1,24 @@
 #include "nrs.hpp"
 #include "nekInterfaceAdapter.hpp"
+#include "fldWriter.hpp"
 
 
 void writeFld(std::string suffix, dfloat t, int step, int outXYZ, int FP64,
               void* o_s, int NSfields)
 {
-  nek::outfld(suffix.c_str(), t, step, outXYZ, FP64, nullptr, nullptr, o_s, NSfields); 
+  writeFld(suffix, t, step, outXYZ, FP64, nullptr, nullptr, o_s, NSfields); 
 }
 
 void writeFld(std::string suffix, dfloat t, int step, int outXYZ, int FP64,
               void* o_u, void* o_p, void* o_s,
               int NSfields)
 {
+  if(platform->options.compareArgs("CHECKPOINT ENGINE", "NEKRS")) {
+    auto deref = [](void *o_fld) { return (o_fld) ? *((occa::memory *)o_fld) : occa::memory(); };
+    fld::write(suffix, t, step, outXYZ, FP64, deref(o_u), deref(o_p), deref(o_s), NSfields);
+    return;
+  }
+
   nek::outfld(suffix.c_str(), t, step, outXYZ, FP64, o_u, o_p, o_s, NSfields); 
 }
 
@@ -18,6 +18,7 @@
 #include "AMGX.hpp"
 #include "hypreWrapper.hpp"
 #include "hypreWrapperDevice.hpp"
+#include "fldWriter.hpp"
 
 namespace fs = std::filesystem;
 
@@ -240,7 +241,8 @@ double dt(int tstep)
            "Invalid time step size %.2e\n", nrs->dt[0]);
 
   // during a neknek simulation, sync dt across all ranks
-  if (nrs->neknek) {
+  // (async coupling requires the same fixed dt in all sessions)
+  if (nrs->neknek && !nrs->neknek->asyncCoupling) {
     MPI_Allreduce(MPI_IN_PLACE, &nrs->dt[0], 1, MPI_DFLOAT, MPI_MIN, platform->comm.mpiCommParent);
   }
 
@@ -518,11 +520,13 @@ int nrsFinalize(nrs_t *nrs)
     if(nrs->wSolver) delete nrs->wSolver;
     if(nrs->uvwSolver) delete nrs->uvwSolver;
     if(nrs->pSolver) delete nrs->pSolver;
-    for(int is; is < nrs->Nscalar; is++) {
-      if(nrs->cds->solver[is]) delete nrs->cds->solver[is]; 
+    for(int is = 0; is < nrs->Nscalar; is++) {
+      if(nrs->cds->solver[is] && nrs->cds->solver[is] != nrs->cds->blockSolver) delete nrs->cds->solver[is]; 
     } 
+    if(nrs->Nscalar && nrs->cds->blockSolver) delete nrs->cds->blockSolver;
     if(nrs->meshSolver) delete nrs->meshSolver;
 
+    fld::finalize();
     hypreWrapper::finalize();
     hypreWrapperDevice::finalize();
     AMGXfinalize();
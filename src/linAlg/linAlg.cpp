@@ -105,6 +105,8 @@ linAlg_t::linAlg_t()
   serial = platform->serial;
   comm = platform->comm.mpiComm;
   timer = 0;
+  dotpTimer = platform->timer.id("dotp");
+  dotpMultiTimer = platform->timer.id("dotpMulti");
 
   if (platform->comm.mpiRank == 0)
     std::cout << "initializing linAlg ...\n";
@@ -645,7 +647,7 @@ dfloat linAlg_t::amaxMany(const dlong N,
 dfloat linAlg_t::norm2(const dlong N, occa::memory &o_x, MPI_Comm _comm)
 {
   if (timer)
-    platform->timer.tic("dotp", 1);
+    platform->timer.tic(dotpTimer, 1);
 
   int Nblock = (N + blocksize - 1) / blocksize;
   const size_t Nbytes = Nblock * sizeof(dfloat);
@@ -676,7 +678,7 @@ dfloat linAlg_t::norm2(const dlong N, occa::memory &o_x, MPI_Comm _comm)
     MPI_Allreduce(MPI_IN_PLACE, &norm, 1, MPI_DFLOAT, MPI_SUM, _comm);
 
   if (timer)
-    platform->timer.toc("dotp");
+    platform->timer.toc(dotpTimer);
 
   return sqrt(norm);
 }
@@ -687,7 +689,7 @@ dfloat linAlg_t::norm2Many(const dlong N,
                            MPI_Comm _comm)
 {
   if (timer)
-    platform->timer.tic("dotp", 1);
+    platform->timer.tic(dotpTimer, 1);
 
   int Nblock = (N + blocksize - 1) / blocksize;
   const size_t Nbytes = Nblock * sizeof(dfloat);
@@ -717,7 +719,7 @@ dfloat linAlg_t::norm2Many(const dlong N,
     MPI_Allreduce(MPI_IN_PLACE, &norm, 1, MPI_DFLOAT, MPI_SUM, _comm);
 
   if (timer)
-    platform->timer.toc("dotp");
+    platform->timer.toc(dotpTimer);
 
   return sqrt(norm);
 }
@@ -725,7 +727,7 @@ dfloat linAlg_t::norm2Many(const dlong N,
 dfloat linAlg_t::norm1(const dlong N, occa::memory &o_x, MPI_Comm _comm)
 {
   if (timer)
-    platform->timer.tic("dotp", 1);
+    platform->timer.tic(dotpTimer, 1);
 
   int Nblock = (N + blocksize - 1) / blocksize;
   const size_t Nbytes = Nblock * sizeof(dfloat);
@@ -755,7 +757,7 @@ dfloat linAlg_t::norm1(const dlong N, occa::memory &o_x, MPI_Comm _comm)
     MPI_Allreduce(MPI_IN_PLACE, &norm, 1, MPI_DFLOAT, MPI_SUM, _comm);
 
   if (timer)
-    platform->timer.toc("dotp");
+    platform->timer.toc(dotpTimer);
 
   return norm;
 }
@@ -766,7 +768,7 @@ dfloat linAlg_t::norm1Many(const dlong N,
                            MPI_Comm _comm)
 {
   if (timer)
-    platform->timer.tic("dotp", 1);
+    platform->timer.tic(dotpTimer, 1);
 
   int Nblock = (N + blocksize - 1) / blocksize;
   const size_t Nbytes = Nblock * sizeof(dfloat);
@@ -797,7 +799,7 @@ dfloat linAlg_t::norm1Many(const dlong N,
     MPI_Allreduce(MPI_IN_PLACE, &norm, 1, MPI_DFLOAT, MPI_SUM, _comm);
 
   if (timer)
-    platform->timer.toc("dotp");
+    platform->timer.toc(dotpTimer);
 
   return norm;
 }
@@ -808,7 +810,7 @@ linAlg_t::innerProd(const dlong N, occa::memory &o_x, occa::memory &o_y, MPI_Com
 {
 
   if (timer)
-    platform->timer.tic("dotp", 1);
+    platform->timer.tic(dotpTimer, 1);
 
   int Nblock = (N + blocksize - 1) / blocksize;
   const size_t Nbytes = Nblock * sizeof(dfloat);
@@ -842,7 +844,7 @@ linAlg_t::innerProd(const dlong N, occa::memory &o_x, occa::memory &o_y, MPI_Com
     MPI_Allreduce(MPI_IN_PLACE, &dot, 1, MPI_DFLOAT, MPI_SUM, _comm);
 
   if (timer)
-    platform->timer.toc("dotp");
+    platform->timer.toc(dotpTimer);
 
   return dot;
 }
@@ -856,7 +858,7 @@ dfloat linAlg_t::weightedInnerProd(const dlong N,
 {
 
   if (timer)
-    platform->timer.tic("dotp", 1);
+    platform->timer.tic(dotpTimer, 1);
 
   int Nblock = (N + blocksize - 1) / blocksize;
   const size_t Nbytes = Nblock * sizeof(dfloat);
@@ -889,7 +891,7 @@ dfloat linAlg_t::weightedInnerProd(const dlong N,
     MPI_Allreduce(MPI_IN_PLACE, &dot, 1, MPI_DFLOAT, MPI_SUM, _comm);
 
   if (timer)
-    platform->timer.toc("dotp");
+    platform->timer.toc(dotpTimer);
 
   platform->flopCounter->add("weightedInnerProd", 3 * static_cast<double>(N));
   return dot;
@@ -906,7 +908,7 @@ void linAlg_t::weightedInnerProdMulti(const dlong N,
                                       const dlong offset)
 {
   if (timer)
-    platform->timer.tic("dotpMulti", 1);
+    platform->timer.tic(dotpMultiTimer, 1);
 
   int Nblock = (N + blocksize - 1) / blocksize;
   const size_t Nbytes = NVec * Nblock * sizeof(dfloat);
@@ -938,7 +940,7 @@ void linAlg_t::weightedInnerProdMulti(const dlong N,
     MPI_Allreduce(MPI_IN_PLACE, result, NVec, MPI_DFLOAT, MPI_SUM, _comm);
 
   if (timer)
-    platform->timer.toc("dotpMulti");
+    platform->timer.toc(dotpMultiTimer);
 
   platform->flopCounter->add("weightedInnerProdMulti", NVec * static_cast<double>(N) * (2 * Nfields + 1));
 }
@@ -955,7 +957,7 @@ void linAlg_t::weightedInnerProdMulti(const dlong N,
                                       const dlong offset)
 {
   if (timer)
-    platform->timer.tic("dotpMulti", 1);
+    platform->timer.tic(dotpMultiTimer, 1);
 
   const int Nblock = (N + blocksize - 1) / blocksize;
 
@@ -977,7 +979,7 @@ void linAlg_t::weightedInnerProdMulti(const dlong N,
   }
 
   if (timer)
-    platform->timer.toc("dotpMulti");
+    platform->timer.toc(dotpMultiTimer);
 
   platform->flopCounter->add("weightedInnerProdMulti", NVec * static_cast<double>(N) * (2 * Nfields + 1));
 }
@@ -991,7 +993,7 @@ dfloat linAlg_t::weightedInnerProdMany(const dlong N,
                                        MPI_Comm _comm)
 {
   if (timer)
-    platform->timer.tic("dotp", 1);
+    platform->timer.tic(dotpTimer, 1);
 
   int Nblock = (N + blocksize - 1) / blocksize;
   const size_t Nbytes = Nblock * sizeof(dfloat);
@@ -1024,7 +1026,7 @@ dfloat linAlg_t::weightedInnerProdMany(const dlong N,
     MPI_Allreduce(MPI_IN_PLACE, &dot, 1, MPI_DFLOAT, MPI_SUM, _comm);
 
   if (timer)
-    platform->timer.toc("dotp");
+    platform->timer.toc(dotpTimer);
 
   platform->flopCounter->add("weightedInnerProdMany", 3 * static_cast<double>(N) * Nfields);
 
@@ -1035,7 +1037,7 @@ dfloat linAlg_t::weightedInnerProdMany(const dlong N,
 dfloat linAlg_t::weightedNorm2(const dlong N, occa::memory &o_w, occa::memory &o_a, MPI_Comm _comm)
 {
   if (timer)
-    platform->timer.tic("dotp", 1);
+    platform->timer.tic(dotpTimer, 1);
 
   int Nblock = (N + blocksize - 1) / blocksize;
   const size_t Nbytes = Nblock * sizeof(dfloat);
@@ -1067,7 +1069,7 @@ dfloat linAlg_t::weightedNorm2(const dlong N, occa::memory &o_w, occa::memory &o
     MPI_Allreduce(MPI_IN_PLACE, &norm, 1, MPI_DFLOAT, MPI_SUM, _comm);
 
   if (timer)
-    platform->timer.toc("dotp");
+    platform->timer.toc(dotpTimer);
 
   platform->flopCounter->add("weightedNorm2", 3 * static_cast<double>(N));
 
@@ -1081,7 +1083,7 @@ dfloat linAlg_t::weightedNorm2Many(const dlong N,
                                    MPI_Comm _comm)
 {
   if (timer)
-    platform->timer.tic("dotp", 1);
+    platform->timer.tic(dotpTimer, 1);
 
   int Nblock = (N + blocksize - 1) / blocksize;
   const size_t Nbytes = Nblock * sizeof(dfloat);
@@ -1113,7 +1115,7 @@ dfloat linAlg_t::weightedNorm2Many(const dlong N,
     MPI_Allreduce(MPI_IN_PLACE, &norm, 1, MPI_DFLOAT, MPI_SUM, _comm);
 
   if (timer)
-    platform->timer.toc("dotp");
+    platform->timer.toc(dotpTimer);
 
   platform->flopCounter->add("weightedNorm2Many", 3 * static_cast<double>(N) * Nfields);
   return sqrt(norm);
@@ -1123,7 +1125,7 @@ dfloat linAlg_t::weightedNorm2Many(const dlong N,
 dfloat linAlg_t::weightedNorm1(const dlong N, occa::memory &o_w, occa::memory &o_a, MPI_Comm _comm)
 {
   if (timer)
-    platform->timer.tic("dotp", 1);
+    platform->timer.tic(dotpTimer, 1);
 
   int Nblock = (N + blocksize - 1) / blocksize;
   const size_t Nbytes = Nblock * sizeof(dfloat);
@@ -1155,7 +1157,7 @@ dfloat linAlg_t::weightedNorm1(const dlong N, occa::memory &o_w, occa::memory &o
     MPI_Allreduce(MPI_IN_PLACE, &norm, 1, MPI_DFLOAT, MPI_SUM, _comm);
 
   if (timer)
-    platform->timer.toc("dotp");
+    platform->timer.toc(dotpTimer);
 
   return norm;
 }
@@ -1167,7 +1169,7 @@ dfloat linAlg_t::weightedNorm1Many(const dlong N,
                                    MPI_Comm _comm)
 {
   if (timer)
-    platform->timer.tic("dotp", 1);
+    platform->timer.tic(dotpTimer, 1);
   int Nblock = (N + blocksize - 1) / blocksize;
   const size_t Nbytes = Nblock * sizeof(dfloat);
   if (o_scratch.size() < Nbytes)
@@ -1198,7 +1200,7 @@ dfloat linAlg_t::weightedNorm1Many(const dlong N,
     MPI_Allreduce(MPI_IN_PLACE, &norm, 1, MPI_DFLOAT, MPI_SUM, _comm);
 
   if (timer)
-    platform->timer.toc("dotp");
+    platform->timer.toc(dotpTimer);
 
   return norm;
 }
@@ -39,6 +39,8 @@ private:
   bool serial;
 
   int timer = 0;
+  int dotpTimer;
+  int dotpMultiTimer;
 
   //scratch space for reductions
   dfloat* scratch;
@@ -286,13 +286,52 @@ MPI_Comm setupSession(cmdOptions *cmdOpt, const MPI_Comm &comm, session_data_t &
         MPI_Abort(comm, EXIT_FAILURE);
       }
       sessionList[nSessions].setupFile = items[0];
-      sessionList[nSessions].size = std::stoi(items[1]);
-      rankSum += sessionList[nSessions].size;
+      // auto (size -1): size follows from the grid point count of the session
+      const bool autoSize = (items[1] == "auto");
+      sessionList[nSessions].size = autoSize ? -1 : std::stoi(items[1]);
+      if(!autoSize && sessionList[nSessions].size <= 0) {
+        if(rank == 0) std::cout << "FATAL ERROR: invalid sess file entry!\n";
+        fflush(stdout);
+        MPI_Abort(comm, EXIT_FAILURE);
+      }
+      if(!autoSize) rankSum += sessionList[nSessions].size;
       nSessions++;
     }
 
     session.nsessions = nSessions;
 
+    std::vector<int> autoSessions;
+    for(int i = 0; i < nSessions; i++)
+      if(sessionList[i].size == -1) autoSessions.push_back(i);
+
+    if(autoSessions.size()) {
+      if(size - rankSum < (int) autoSessions.size()) {
+        if(rank == 0) std::cout << "FATAL ERROR: not enough ranks for auto sized sessions!\n";
+        fflush(stdout);
+        MPI_Abort(comm, EXIT_FAILURE);
+      }
+
+      std::vector<double> work(autoSessions.size());
+      if(rank == 0) {
+        for(int i = 0; i < autoSessions.size(); i++)
+          work[i] = neknekSessionWork(sessionList[autoSessions[i]].setupFile);
+      }
+      MPI_Bcast(work.data(), work.size(), MPI_DOUBLE, 0, comm);
+
+      const auto split = neknekRankSplit(work, size - rankSum);
+      for(int i = 0; i < autoSessions.size(); i++) {
+        sessionList[autoSessions[i]].size = split[i];
+        rankSum += split[i];
+      }
+
+      if(rank == 0) {
+        std::cout << "auto sized sessions:";
+        for(int i = 0; i < nSessions; i++)
+          std::cout << " " << sessionList[i].setupFile << ":" << sessionList[i].size << ";";
+        std::cout << "\n";
+      }
+    }
+
     int err = 0;
     if(rankSum != size) err = 1;
     MPI_Allreduce(MPI_IN_PLACE, &err, 1, MPI_INT, MPI_SUM, comm);
@@ -230,8 +230,10 @@ struct mesh_t
   occa::kernel surfaceIntegralKernel;
 };
 
+// pfloatGeom: keep geometric factors and derivative matrices in pfloat only
 mesh_t *createMeshMG(mesh_t* _mesh,
-                     int Nc);
+                     int Nc,
+                     bool pfloatGeom);
 
 occa::properties meshKernelProperties(int N);
 // serial sort
@@ -266,7 +266,8 @@ mesh_t* duplicateMesh(MPI_Comm comm,
 */
 
 mesh_t *createMeshMG(mesh_t* _mesh,
-                     int Nc)
+                     int Nc,
+                     bool pfloatGeom)
 {
   mesh_t* mesh = new mesh_t();
   memcpy(mesh, _mesh, sizeof(mesh_t));
@@ -313,10 +314,12 @@ mesh_t *createMeshMG(mesh_t* _mesh,
                                        mesh->o_DT,
                                        mesh->o_DTPfloat);
 
-    // TODO: once full preconditioner is in FP32, uncomment below
-    //mesh->o_D.free();
-    //mesh->o_DT.free();
-    //mesh->o_ggeo.free();
+    // MG levels only run pfloat operators (Ax, Jacobi diagonal)
+    if (pfloatGeom) {
+      mesh->o_D.free();
+      mesh->o_DT.free();
+      mesh->o_ggeo.free();
+    }
   }
 
   return mesh;
@@ -172,46 +172,76 @@ void applyDirichletScalars(nrs_t *nrs, double time, occa::memory& o_S, occa::mem
 {
   cds_t *cds = nrs->cds;
   for (int is = 0; is < cds->NSfields; is++) {
+    // block members are handled all at once by the first one
+    const bool blockMember =
+        cds->blockNfields && is >= cds->blockFirst && is < cds->blockFirst + cds->blockNfields;
+    if (blockMember && (is != cds->blockFirst || !cdsBlockCompute(cds)))
+      continue;
     if (!cds->compute[is])
       continue;
-    mesh_t *mesh = cds->mesh[0];
-    oogs_t *gsh = cds->gshT;
-    if (is) {
-      mesh = cds->meshV;
-      gsh = cds->gsh;
-    }
+    oogs_t *gsh = (is) ? cds->gsh : cds->gshT;
+    const int nfld = blockMember ? cds->blockNfields : 1;
 
-    auto o_diff_i = cds->o_diff + cds->fieldOffsetScan[is] * sizeof(dfloat);
-    auto o_rho_i = cds->o_rho + cds->fieldOffsetScan[is] * sizeof(dfloat);
+    // max number of fields a single exchange on gsh can carry
+    const int nfldGs = (gsh == nrs->gsh) ? nrs->NVfields : 1;
 
-    platform->linAlg->fill(cds->fieldOffset[is], TINY, platform->o_mempool.slice0);
+    platform->linAlg->fill(nfld * cds->fieldOffset[is], TINY, platform->o_mempool.slice0);
 
     for (int sweep = 0; sweep < 2; sweep++) {
-      cds->dirichletBCKernel(mesh->Nelements,
-                             cds->fieldOffset[is],
-                             is,
-                             time,
-                             mesh->o_sgeo,
-                             mesh->o_x,
-                             mesh->o_y,
-                             mesh->o_z,
-                             mesh->o_vmapM,
-                             mesh->o_EToB,
-                             cds->o_EToB[is],
-                             cds->o_Ue,
-                             o_diff_i,
-                             o_rho_i,
-                             cds->neknek ? cds->neknek->o_pointMap : o_NULL,
-                             cds->neknek ? cds->neknek->o_U : o_NULL,
-                             cds->neknek ? cds->neknek->o_S : o_NULL,
-                             *(cds->o_usrwrk),
-                             platform->o_mempool.slice0);
-
-      if (sweep == 0)
-        oogs::startFinish(platform->o_mempool.slice0, 1, cds->fieldOffset[is], ogsDfloat, ogsMax, gsh);
-      if (sweep == 1)
-        oogs::startFinish(platform->o_mempool.slice0, 1, cds->fieldOffset[is], ogsDfloat, ogsMin, gsh);
+      for (int fld = 0; fld < nfld; fld++) {
+        const int isf = is + fld;
+        mesh_t *mesh = (isf) ? cds->meshV : cds->mesh[0];
+        auto o_diff_i = cds->o_diff + cds->fieldOffsetScan[isf] * sizeof(dfloat);
+        auto o_rho_i = cds->o_rho + cds->fieldOffsetScan[isf] * sizeof(dfloat);
+        occa::memory o_bc = platform->o_mempool.slice0 + (fld * sizeof(dfloat)) * cds->fieldOffset[is];
+
+        cds->dirichletBCKernel(mesh->Nelements,
+                               cds->fieldOffset[isf],
+                               isf,
+                               time,
+                               mesh->o_sgeo,
+                               mesh->o_x,
+                               mesh->o_y,
+                               mesh->o_z,
+                               mesh->o_vmapM,
+                               mesh->o_EToB,
+                               cds->o_EToB[isf],
+                               cds->o_Ue,
+                               o_diff_i,
+                               o_rho_i,
+                               cds->neknek ? cds->neknek->o_pointMap : o_NULL,
+                               cds->neknek ? cds->neknek->o_U : o_NULL,
+                               cds->neknek ? cds->neknek->o_S : o_NULL,
+                               *(cds->o_usrwrk),
+                               o_bc);
+      }
+
+      for (int fld = 0; fld < nfld; fld += nfldGs) {
+        occa::memory o_bc = platform->o_mempool.slice0 + (fld * sizeof(dfloat)) * cds->fieldOffset[is];
+        const int k = std::min(nfldGs, nfld - fld);
+        if (sweep == 0)
+          oogs::startFinish(o_bc, k, cds->fieldOffset[is], ogsDfloat, ogsMax, gsh);
+        if (sweep == 1)
+          oogs::startFinish(o_bc, k, cds->fieldOffset[is], ogsDfloat, ogsMin, gsh);
+      }
     }
+
+    if (blockMember) {
+      if (cds->blockSolver->Nmasked) {
+        const auto first = cds->fieldOffsetScan[cds->blockFirst] * sizeof(dfloat);
+        const auto Nbytes = (cds->blockNfields * sizeof(dfloat)) * cds->fieldOffset[is];
+        occa::memory o_Sblock = o_S.slice(first, Nbytes);
+        occa::memory o_Sblock_e = o_Se.slice(first, Nbytes);
+        cds->maskCopy2Kernel(cds->blockSolver->Nmasked,
+                             0,
+                             cds->blockSolver->o_maskIds,
+                             platform->o_mempool.slice0,
+                             o_Sblock,
+                             o_Sblock_e);
+      }
+      continue;
+    }
+
     occa::memory o_Si =
         o_S.slice(cds->fieldOffsetScan[is] * sizeof(dfloat), cds->fieldOffset[is] * sizeof(dfloat));
     occa::memory o_Si_e =
@@ -29,7 +29,14 @@ void setup(nrs_t *nrs)
   firstTime = 0;
 }
 
-dfloat computeCFL(nrs_t *nrs)
+namespace
+{
+// non-blocking evaluation at unit dt, valid until the next step starts
+MPI_Request request = MPI_REQUEST_NULL;
+dfloat unitCFL = 0;
+int unitCFLStep = -1;
+
+dfloat localCFL(nrs_t *nrs, dfloat dt)
 {
   mesh_t *mesh = nrs->meshV;
 
@@ -38,7 +45,7 @@ dfloat computeCFL(nrs_t *nrs)
 
   // Compute cfl factors i.e. dt* U / h
   nrs->cflKernel(mesh->Nelements,
-                 nrs->dt[0],
+                 dt,
                  mesh->o_vgeo,
                  nrs->o_idH,
                  nrs->fieldOffset,
@@ -46,16 +53,35 @@ dfloat computeCFL(nrs_t *nrs)
                  mesh->o_U,
                  platform->o_mempool.slice0);
 
-  // find the local maximum of CFL number
-  platform->o_mempool.slice0.copyTo(platform->mempool.slice0, mesh->Nelements * sizeof(dfloat));
+  // element maxima are reduced on the device, only one value per block is copied back
+  return platform->linAlg->max(mesh->Nelements, platform->o_mempool.slice0, MPI_COMM_SELF);
+}
+} // namespace
+
+void computeCFLStart(nrs_t *nrs)
+{
+  if (!platform->options.compareArgs("CFL NONBLOCKING", "TRUE"))
+    return;
+
+  if (request != MPI_REQUEST_NULL)
+    MPI_Wait(&request, MPI_STATUS_IGNORE);
+
+  unitCFL = localCFL(nrs, 1.0);
+  MPI_Iallreduce(MPI_IN_PLACE, &unitCFL, 1, MPI_DFLOAT, MPI_MAX, platform->comm.mpiComm, &request);
+  unitCFLStep = nrs->tstep;
+}
 
-  // finish reduction
-  dfloat cfl = 0.f;
-  for (dlong n = 0; n < mesh->Nelements; ++n)
-    cfl = std::max(cfl, platform->mempool.slice0[n]);
+dfloat computeCFL(nrs_t *nrs)
+{
+  // reuse posted result as long as the velocity has not been advanced
+  if (unitCFLStep >= 0 && unitCFLStep == nrs->tstep) {
+    if (request != MPI_REQUEST_NULL)
+      MPI_Wait(&request, MPI_STATUS_IGNORE);
+    return unitCFL * nrs->dt[0];
+  }
 
-  dfloat gcfl = 0.f;
-  MPI_Allreduce(&cfl, &gcfl, 1, MPI_DFLOAT, MPI_MAX, platform->comm.mpiComm);
+  dfloat cfl = localCFL(nrs, nrs->dt[0]);
+  MPI_Allreduce(MPI_IN_PLACE, &cfl, 1, MPI_DFLOAT, MPI_MAX, platform->comm.mpiComm);
 
-  return gcfl;
+  return cfl;
 }
@@ -4,4 +4,7 @@
 #include "nrs.hpp"
 dfloat computeCFL(nrs_t *nrs);
 
+// post global CFL reduction of the current step (CFL NONBLOCKING), completed by computeCFL
+void computeCFLStart(nrs_t *nrs);
+
 #endif
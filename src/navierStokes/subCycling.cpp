@@ -4,6 +4,7 @@
 
 #include "linAlg.hpp"
 #include "nrs.hpp"
+#include "subCycling.hpp"
 
 static void flops(mesh_t *mesh, int Nfields)
 {
@@ -295,6 +296,7 @@ occa::memory velocitySubCycle(
           extC[2] = (t - tn0) * (t - tn1) / ((tn2 - tn0) * (tn2 - tn1));
           break;
         }
+        UrstSlotCoeffs(nrs->UrstHead, nrs->nEXT, extC);
 
         if (mesh->NglobalGatherElements) {
           if (platform->options.compareArgs("ADVECTION TYPE", "CUBATURE"))
@@ -8,7 +8,19 @@ occa::memory velocitySubCycleMovingMesh(nrs_t* nrs, int nEXT, dfloat time, occa:
 occa::memory scalarSubCycleMovingMesh(cds_t *cds, int nEXT, dfloat time,
                                       int is, occa::memory o_U,
                                       occa::memory o_S);
-occa::memory scalarSubCycle(cds_t *cds, int nEXT, dfloat time, int is,
+// advances scalars is, ..., is+Nfields-1 in one go, solution of scalar is+fld is
+// returned at offset fld*fieldOffset[is]
+occa::memory scalarSubCycle(cds_t *cds, int nEXT, dfloat time, int is, int Nfields,
                             occa::memory o_U, occa::memory o_S);
+// number of consecutive scalars starting at is which can be subcycled together
+int scalarSubCycleBatchSize(cds_t *cds, int is);
+
+// map extrapolation coefficients from history levels to o_Urst ring buffer slots
+inline void UrstSlotCoeffs(int head, int nSlots, dfloat *c)
+{
+  dfloat level[3] = {c[0], c[1], c[2]};
+  for (int k = 0; k < nSlots; k++)
+    c[(head + k) % nSlots] = level[k];
+}
 
 #endif
@@ -274,18 +274,24 @@ void initStep(nrs_t *nrs, dfloat time, dfloat dt, int tstep)
     if (nrs->cht)
       mesh = nrs->cds->mesh[0];
     const auto NbyteCubature = (nrs->NVfields * sizeof(dfloat)) * nrs->cubatureOffset;
-    for (int s = nrs->nEXT; s > 1; s--) {
-      const auto Nbyte = nrs->fieldOffset * sizeof(dfloat);
-      if (movingMesh) {
+    if (movingMesh) {
+      // invLMM history is consumed with the same coefficients, keep physical ordering
+      nrsCheck(nrs->UrstHead != 0, MPI_COMM_SELF, EXIT_FAILURE,
+               "%s\n", "Rotating the Urst history is not supported for moving meshes!");
+      for (int s = nrs->nEXT; s > 1; s--) {
+        const auto Nbyte = nrs->fieldOffset * sizeof(dfloat);
         mesh->o_divU.copyFrom(mesh->o_divU, Nbyte, (s - 1) * Nbyte, (s - 2) * Nbyte);
         nrs->o_relUrst.copyFrom(nrs->o_relUrst,
                                 NbyteCubature,
                                 (s - 1) * NbyteCubature,
                                 (s - 2) * NbyteCubature);
       }
-      else {
-        nrs->o_Urst.copyFrom(nrs->o_Urst, NbyteCubature, (s - 1) * NbyteCubature, (s - 2) * NbyteCubature);
-      }
+    }
+    else {
+      // rotate instead of shifting, new level 0 overwrites the oldest slot
+      nrs->UrstHead = (nrs->UrstHead + nrs->nEXT - 1) % nrs->nEXT;
+      if (nrs->Nscalar)
+        cds->UrstHead = nrs->UrstHead;
     }
     if (movingMesh) {
       double flops = 18 * (mesh->Np * mesh->Nq + mesh->Np);
@@ -301,7 +307,8 @@ void initStep(nrs_t *nrs, dfloat time, dfloat dt, int tstep)
   }
 
   const bool relative = movingMesh && nrs->Nsubsteps;
-  occa::memory &o_Urst = relative ? nrs->o_relUrst : nrs->o_Urst;
+  const auto UrstSlotOffset = (nrs->UrstHead * nrs->NVfields * sizeof(dfloat)) * nrs->cubatureOffset;
+  occa::memory o_Urst = relative ? nrs->o_relUrst : nrs->o_Urst + UrstSlotOffset;
   mesh = nrs->meshV;
   double flopCount = 0.0;
 
@@ -421,6 +428,9 @@ bool runStep(nrs_t *nrs, std::function<bool(int)> convergenceCheck, int stage)
   if (!platform->options.compareArgs("MESH SOLVER", "NONE"))
     meshSolve(nrs, timeNew, nrs->meshV->o_U, stage);
 
+  // velocities are final, overlap the reduction with udf and output work
+  computeCFLStart(nrs);
+
   nrs->timeStepConverged = convergenceCheck(stage);
 
   platform->timer.tic("udfExecuteStep", 1);
@@ -499,6 +509,10 @@ void makeq(nrs_t *nrs, dfloat time, int tstep, occa::memory o_FS, occa::memory o
     platform->timer.toc("udfSEqnSource");
   }
 
+  // scalars [subCycledBegin, subCycledEnd) have been subcycled together
+  int subCycledBegin = 0;
+  int subCycledEnd = 0;
+
   for (int is = 0; is < cds->NSfields; is++) {
     if (!cds->compute[is])
       continue;
@@ -545,8 +559,16 @@ void makeq(nrs_t *nrs, dfloat time, int tstep, occa::memory o_FS, occa::memory o
         if (movingMesh)
           o_Usubcycling =
               scalarSubCycleMovingMesh(cds, std::min(tstep, cds->nEXT), time, is, cds->o_U, cds->o_S);
-        else
-          o_Usubcycling = scalarSubCycle(cds, std::min(tstep, cds->nEXT), time, is, cds->o_U, cds->o_S);
+        else {
+          if (is >= subCycledEnd) {
+            const int nfld = scalarSubCycleBatchSize(cds, is);
+            scalarSubCycle(cds, std::min(tstep, cds->nEXT), time, is, nfld, cds->o_U, cds->o_S);
+            subCycledBegin = is;
+            subCycledEnd = is + nfld;
+          }
+          o_Usubcycling = platform->o_mempool.slice0 +
+                          (is - subCycledBegin) * cds->fieldOffset[is] * sizeof(dfloat);
+        }
       }
       else {
         if (platform->options.compareArgs("ADVECTION TYPE", "CUBATURE"))
@@ -618,6 +640,16 @@ void scalarSolve(nrs_t *nrs, dfloat time, occa::memory o_S, int stage)
 
   platform->timer.tic("scalarSolve", 1);
   for (int is = 0; is < cds->NSfields; is++) {
+    if (cds->blockNfields && is >= cds->blockFirst && is < cds->blockFirst + cds->blockNfields) {
+      if (is == cds->blockFirst && cdsBlockCompute(cds)) {
+        occa::memory o_Snew = cdsSolveBlock(cds, time, stage);
+        o_Snew.copyTo(o_S,
+                      cds->blockNfields * cds->fieldOffset[is] * sizeof(dfloat),
+                      cds->fieldOffsetScan[is] * sizeof(dfloat));
+      }
+      continue;
+    }
+
     if (!cds->compute[is])
       continue;
 
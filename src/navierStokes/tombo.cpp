@@ -14,16 +14,34 @@ occa::memory pressureSolve(nrs_t* nrs, dfloat time, int stage)
   double flopCount = 0.0;
   mesh_t* mesh = nrs->meshV;
 
-  nrs->curlKernel(mesh->Nelements,
-	                1,
-                  mesh->o_vgeo,
-                  mesh->o_D,
-                  nrs->fieldOffset,
-                  nrs->o_Ue,
-                  platform->o_mempool.slice0);
+  // elements touching the inter-rank interface first, interior ones while the exchange is in flight
+  if (mesh->NglobalGatherElements)
+    nrs->curlKernel(mesh->NglobalGatherElements,
+                    mesh->o_globalGatherElementList,
+                    1,
+                    mesh->o_vgeo,
+                    mesh->o_D,
+                    nrs->fieldOffset,
+                    nrs->o_Ue,
+                    platform->o_mempool.slice0);
+
+  oogs::start(platform->o_mempool.slice0, nrs->NVfields, nrs->fieldOffset,ogsDfloat, ogsAdd, nrs->gsh);
+  platform->timer.gsOverlapBegin("pressure rhs curl");
+
+  if (mesh->NlocalGatherElements)
+    nrs->curlKernel(mesh->NlocalGatherElements,
+                    mesh->o_localGatherElementList,
+                    1,
+                    mesh->o_vgeo,
+                    mesh->o_D,
+                    nrs->fieldOffset,
+                    nrs->o_Ue,
+                    platform->o_mempool.slice0);
   flopCount += static_cast<double>(mesh->Nelements) * (18 * mesh->Np * mesh->Nq + 36 * mesh->Np);
 
-  oogs::startFinish(platform->o_mempool.slice0, nrs->NVfields, nrs->fieldOffset,ogsDfloat, ogsAdd, nrs->gsh);
+  platform->timer.gsOverlapWait("pressure rhs curl");
+  oogs::finish(platform->o_mempool.slice0, nrs->NVfields, nrs->fieldOffset,ogsDfloat, ogsAdd, nrs->gsh);
+  platform->timer.gsOverlapEnd("pressure rhs curl");
 
   platform->linAlg->axmyVector(
     mesh->Nlocal,
@@ -37,6 +55,7 @@ occa::memory pressureSolve(nrs_t* nrs, dfloat time, int stage)
 
   nrs->curlKernel(
     mesh->Nelements,
+    mesh->o_elementList,
     1,
     mesh->o_vgeo,
     mesh->o_D,
@@ -69,19 +88,33 @@ occa::memory pressureSolve(nrs_t* nrs, dfloat time, int stage)
 
   const int viscContribution = (nrs->nBDF > 1) ? 1 : 0; 
   occa::memory o_irho = nrs->o_ellipticCoeff;
-  nrs->pressureRhsKernel(
-    mesh->Nelements * mesh->Np,
-    nrs->fieldOffset,
-    viscContribution,
-    nrs->o_mue,
-    o_irho,
-    nrs->o_BF,
-    platform->o_mempool.slice3,
-    platform->o_mempool.slice0,
-    platform->o_mempool.slice6);
+  auto pressureRhs = [&](dlong Nelements, occa::memory &o_elementList) {
+    nrs->pressureRhsKernel(
+      Nelements,
+      o_elementList,
+      nrs->fieldOffset,
+      viscContribution,
+      nrs->o_mue,
+      o_irho,
+      nrs->o_BF,
+      platform->o_mempool.slice3,
+      platform->o_mempool.slice0,
+      platform->o_mempool.slice6);
+  };
+
+  if (mesh->NglobalGatherElements)
+    pressureRhs(mesh->NglobalGatherElements, mesh->o_globalGatherElementList);
+
+  oogs::start(platform->o_mempool.slice6, nrs->NVfields, nrs->fieldOffset,ogsDfloat, ogsAdd, nrs->gsh);
+  platform->timer.gsOverlapBegin("pressure rhs");
+
+  if (mesh->NlocalGatherElements)
+    pressureRhs(mesh->NlocalGatherElements, mesh->o_localGatherElementList);
   flopCount += 12 * static_cast<double>(mesh->Nlocal);
 
-  oogs::startFinish(platform->o_mempool.slice6, nrs->NVfields, nrs->fieldOffset,ogsDfloat, ogsAdd, nrs->gsh);
+  platform->timer.gsOverlapWait("pressure rhs");
+  oogs::finish(platform->o_mempool.slice6, nrs->NVfields, nrs->fieldOffset,ogsDfloat, ogsAdd, nrs->gsh);
+  platform->timer.gsOverlapEnd("pressure rhs");
 
   platform->linAlg->axmyVector(
     mesh->Nlocal,
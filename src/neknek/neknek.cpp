@@ -4,6 +4,12 @@
 #include "nrs.hpp"
 #include "nekInterfaceAdapter.hpp"
 #include "pointInterpolation.hpp"
+#include "re2Reader.hpp"
+#include "inipp.hpp"
+#include "fileUtils.hpp"
+#include <algorithm>
+#include <fstream>
+#include <numeric>
 #include <vector>
 
 namespace {
@@ -339,6 +345,43 @@ void neknekSetup(nrs_t *nrs)
   findInterpPoints(nrs);
 }
 
+void lagBoundaryState(neknek_t *neknek, nrs_t *nrs)
+{
+  for (int s = neknek->nEXT + 1; s > 1; s--) {
+    auto Nbyte = nrs->NVfields * neknek->fieldOffset * sizeof(dfloat);
+    neknek->o_U.copyFrom(neknek->o_U, Nbyte, (s - 1) * Nbyte, (s - 2) * Nbyte);
+
+    Nbyte = neknek->Nscalar * neknek->fieldOffset * sizeof(dfloat);
+    neknek->o_S.copyFrom(neknek->o_S, Nbyte, (s - 1) * Nbyte, (s - 2) * Nbyte);
+  }
+}
+
+void extrapolateBoundaryState(neknek_t *neknek, nrs_t *nrs)
+{
+  neknek->o_coeffEXT.copyFrom(neknek->coeffEXT.data(), neknek->nEXT * sizeof(dfloat));
+
+  auto o_Uold = neknek->o_U + neknek->fieldOffset * nrs->NVfields * sizeof(dfloat);
+  auto o_Sold = neknek->o_S + neknek->fieldOffset * neknek->Nscalar * sizeof(dfloat);
+
+  nrs->extrapolateKernel(neknek->npt,
+                         nrs->NVfields,
+                         neknek->nEXT,
+                         neknek->fieldOffset,
+                         neknek->o_coeffEXT,
+                         o_Uold,
+                         neknek->o_U);
+
+  if (neknek->Nscalar) {
+    nrs->extrapolateKernel(neknek->npt,
+                           neknek->Nscalar,
+                           neknek->nEXT,
+                           neknek->fieldOffset,
+                           neknek->o_coeffEXT,
+                           o_Sold,
+                           neknek->o_S);
+  }
+}
+
 } // namespace
 
 bool checkCoupled(nrs_t *nrs)
@@ -365,6 +408,63 @@ bool checkCoupled(nrs_t *nrs)
   return minPointsAcrossSessions > 0;
 }
 
+double neknekSessionWork(const std::string &setupFile)
+{
+  std::ifstream f(setupFile + ".par");
+  nrsCheck(!f.is_open(), MPI_COMM_SELF, EXIT_FAILURE, "Cannot find %s.par!\n", setupFile.c_str());
+  std::stringstream is;
+  is << f.rdbuf();
+
+  inipp::Ini par;
+  par.parse(is, false);
+  par.interpolate();
+
+  int N = 0;
+  par.extract("general", "polynomialorder", N);
+  nrsCheck(N < 1, MPI_COMM_SELF, EXIT_FAILURE, "Invalid polynomialOrder in %s.par!\n", setupFile.c_str());
+
+  // mesh file is relative to the case directory
+  const auto caseDir = fs::path(setupFile).parent_path();
+  std::string meshFile = fs::path(setupFile).filename().string() + ".re2";
+  par.extract("mesh", "file", meshFile);
+  meshFile = (caseDir / meshFile).string();
+
+  int nelgt, nelgv;
+  re2::nelg(meshFile, nelgt, nelgv, MPI_COMM_SELF);
+
+  // solve time per step scales with the number of grid points
+  return static_cast<double>(nelgt) * N * N * N;
+}
+
+std::vector<int> neknekRankSplit(const std::vector<double> &work, int nRanks)
+{
+  const int nSessions = work.size();
+  nrsCheck(nRanks < nSessions, MPI_COMM_SELF, EXIT_FAILURE, "%s\n", "Not enough ranks for all sessions!");
+
+  const auto workSum = std::accumulate(work.begin(), work.end(), 0.0);
+
+  // largest remainder apportionment with at least one rank per session
+  std::vector<int> size(nSessions, 1);
+  std::vector<double> remainder(nSessions, 0);
+  int nAssigned = nSessions;
+  for (int i = 0; i < nSessions; i++) {
+    const double share = (workSum > 0) ? (nRanks - nSessions) * work[i] / workSum : 0;
+    size[i] += static_cast<int>(share);
+    remainder[i] = share - static_cast<int>(share);
+    nAssigned += static_cast<int>(share);
+  }
+
+  std::vector<int> order(nSessions);
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&](int a, int b) { return remainder[a] > remainder[b]; });
+  for (int i = 0; nAssigned < nRanks; i = (i + 1) % nSessions) {
+    size[order[i]]++;
+    nAssigned++;
+  }
+
+  return size;
+}
+
 neknek_t::neknek_t(nrs_t *nrs, const session_data_t &session)
     : nsessions(session.nsessions), sessionID(session.sessionID), globalComm(session.globalComm),
       localComm(session.localComm)
@@ -385,8 +485,42 @@ neknek_t::neknek_t(nrs_t *nrs, const session_data_t &session)
   this->coeffEXT.resize(this->nEXT);
   this->o_coeffEXT = platform->device.malloc(this->nEXT * sizeof(dfloat));
 
+  this->asyncCoupling = platform->options.compareArgs("NEKNEK COUPLING", "ASYNC");
+  platform->options.getArgs("NEKNEK BALANCE STEPS", this->balanceSteps);
+
   neknekSetup(nrs);
 
+  if (this->asyncCoupling) {
+    nrsCheck(this->globalMovingMesh,
+             platform->comm.mpiCommParent,
+             EXIT_FAILURE,
+             "%s\n",
+             "async coupling does not support moving meshes!");
+
+    int variableDt = platform->options.compareArgs("VARIABLE DT", "TRUE");
+    MPI_Allreduce(MPI_IN_PLACE, &variableDt, 1, MPI_INT, MPI_MAX, platform->comm.mpiCommParent);
+    nrsCheck(variableDt,
+             platform->comm.mpiCommParent,
+             EXIT_FAILURE,
+             "%s\n",
+             "async coupling requires a fixed time step!");
+
+    double dt[2] = {0, 0};
+    platform->options.getArgs("DT", dt[0]);
+    dt[1] = -dt[0];
+    MPI_Allreduce(MPI_IN_PLACE, dt, 2, MPI_DOUBLE, MPI_MIN, platform->comm.mpiCommParent);
+    nrsCheck(dt[0] != -dt[1],
+             platform->comm.mpiCommParent,
+             EXIT_FAILURE,
+             "%s\n",
+             "async coupling requires the same time step in all sessions!");
+
+    const dlong nFields = nrs->NVfields + this->Nscalar;
+    this->o_fldIn = platform->device.malloc(std::max<size_t>(nFields * nrs->fieldOffset, 1) * sizeof(dfloat));
+    this->o_fldOut = platform->device.malloc(std::max<size_t>(nFields * this->fieldOffset, 1) * sizeof(dfloat));
+    this->lagTimes.resize(this->nEXT, 0.0);
+  }
+
   // variable p0th + nek-nek is not supported
   int issueError = 0;
   if (nrs->pSolver->allNeumann && platform->options.compareArgs("LOWMACH", "TRUE")) {
@@ -398,14 +532,65 @@ neknek_t::neknek_t(nrs_t *nrs, const session_data_t &session)
   this->copyNekNekPointsKernel = platform->kernels.get("copyNekNekPoints");
 }
 
+// Measure the time each session spends outside of the coupling wait and
+// report the rank split that would equalize it across sessions.
+void neknek_t::checkRankBalance(int tstep)
+{
+  if (this->balanceSteps < 1 || tstep > this->balanceSteps + 2)
+    return;
+
+  // skip the first step (setup, kernel warmup), measure steps 2 to balanceSteps + 1
+  const double now = MPI_Wtime();
+  if (tstep == 2) {
+    this->balanceStart = now;
+    this->balanceWait = 0;
+  }
+  if (tstep < this->balanceSteps + 2)
+    return;
+
+  double busy = now - this->balanceStart - this->balanceWait;
+  MPI_Allreduce(MPI_IN_PLACE, &busy, 1, MPI_DOUBLE, MPI_MAX, platform->comm.mpiComm);
+
+  // assume ideal strong scaling within a session
+  std::vector<double> work(this->nsessions, 0);
+  std::vector<int> size(this->nsessions, 0);
+  work[this->sessionID] = busy * platform->comm.mpiCommSize;
+  size[this->sessionID] = platform->comm.mpiCommSize;
+  MPI_Allreduce(MPI_IN_PLACE, work.data(), this->nsessions, MPI_DOUBLE, MPI_MAX, platform->comm.mpiCommParent);
+  MPI_Allreduce(MPI_IN_PLACE, size.data(), this->nsessions, MPI_INT, MPI_MAX, platform->comm.mpiCommParent);
+
+  const auto split = neknekRankSplit(work, std::accumulate(size.begin(), size.end(), 0));
+
+  if (platform->comm.mpiRank == 0) {
+    printf("neknek rank balance over steps 2-%d:\n", this->balanceSteps + 1);
+    for (int i = 0; i < this->nsessions; i++) {
+      printf("  session %d: %.3es on %d ranks, suggested %d ranks\n",
+             i,
+             work[i] / size[i],
+             size[i],
+             split[i]);
+    }
+  }
+}
+
 void neknek_t::updateBoundary(nrs_t *nrs, int tstep, int stage)
 {
+  if (stage == 1)
+    checkRankBalance(tstep);
+
+  if (this->asyncCoupling) {
+    updateBoundaryAsync(nrs, tstep, stage);
+    return;
+  }
+
   // do not invoke barrier -- this is performed later
   platform->timer.tic("neknek update boundary", 0);
 
   // do not invoke barrier in timer_t::tic
   platform->timer.tic("neknek sync", 0);
+  const double tWait = MPI_Wtime();
   MPI_Barrier(platform->comm.mpiCommParent);
+  this->balanceWait += MPI_Wtime() - tWait;
   platform->timer.toc("neknek sync");
   this->tSync = platform->timer.query("neknek sync", "HOST:MAX");
 
@@ -433,37 +618,98 @@ void neknek_t::updateBoundary(nrs_t *nrs, int tstep, int stage)
     for (int i = this->nEXT; i > extOrder; i--)
       this->coeffEXT[i - 1] = 0.0;
 
-    this->o_coeffEXT.copyFrom(this->coeffEXT.data(), this->nEXT * sizeof(dfloat));
+    lagBoundaryState(this, nrs);
+    extrapolateBoundaryState(this, nrs);
+  }
 
-    for (int s = this->nEXT + 1; s > 1; s--) {
-      auto Nbyte = nrs->NVfields * this->fieldOffset * sizeof(dfloat);
-      this->o_U.copyFrom(this->o_U, Nbyte, (s - 1) * Nbyte, (s - 2) * Nbyte);
+  platform->timer.toc("neknek exchange");
+
+  this->tExch = platform->timer.query("neknek exchange", "DEVICE:MAX");
+  this->ratio = this->tSync / this->tExch;
+
+  platform->timer.toc("neknek update boundary");
+}
 
-      Nbyte = this->Nscalar * this->fieldOffset * sizeof(dfloat);
-      this->o_S.copyFrom(this->o_S, Nbyte, (s - 1) * Nbyte, (s - 2) * Nbyte);
+// Each step posts the current state with non-blocking sends and consumes the
+// partner state posted one step earlier, so sessions can drift apart by a
+// step without waiting. For the step to t(n) the newest consumed state is
+// from t(n-2), one step older than in the synchronous coupling (t(n-1)).
+// The lagged states are extrapolated to the new time.
+void neknek_t::updateBoundaryAsync(nrs_t *nrs, int tstep, int stage)
+{
+  // lagged data is refreshed once per step
+  if (stage > 1)
+    return;
+
+  platform->timer.tic("neknek update boundary", 0);
+
+  auto *findpts = this->interpolator->ptr();
+  auto &data = this->interpolator->data();
+  const dlong nFields = nrs->NVfields + this->Nscalar;
+
+  const auto NbyteU = nrs->NVfields * nrs->fieldOffset * sizeof(dfloat);
+  this->o_fldIn.copyFrom(nrs->o_U, NbyteU);
+  if (this->Nscalar)
+    this->o_fldIn.copyFrom(nrs->cds->o_S, this->Nscalar * nrs->fieldOffset * sizeof(dfloat), NbyteU);
+
+  auto pushLagged = [&](double time) {
+    this->o_U.copyFrom(this->o_fldOut, nrs->NVfields * this->fieldOffset * sizeof(dfloat));
+    if (this->Nscalar)
+      this->o_S.copyFrom(this->o_fldOut,
+                         this->Nscalar * this->fieldOffset * sizeof(dfloat),
+                         0,
+                         nrs->NVfields * this->fieldOffset * sizeof(dfloat));
+    lagBoundaryState(this, nrs);
+
+    for (int i = this->nEXT - 1; i > 0; i--)
+      this->lagTimes[i] = this->lagTimes[i - 1];
+    this->lagTimes[0] = time;
+    this->nLagged = std::min(this->nLagged + 1, this->nEXT);
+  };
+
+  platform->timer.tic("neknek sync", 0);
+  const double tWait = MPI_Wtime();
+  if (this->nLagged == 0) {
+    // all sessions start together, this also sets up the exchange plan
+    MPI_Barrier(platform->comm.mpiCommParent);
+    this->interpolator->eval(nFields, nrs->fieldOffset, this->o_fldIn, this->fieldOffset, this->o_fldOut);
+    pushLagged(nrs->timePrevious);
+  }
+  else {
+    findpts->evalStart(this->npt, nFields, nrs->fieldOffset, this->o_fldIn, &data);
+    this->postedTimes.push_back(nrs->timePrevious);
+
+    // consume the partner state from the previous step
+    if (this->postedTimes.size() > 1) {
+      findpts->evalFinish(this->npt,
+                          nFields,
+                          nrs->fieldOffset,
+                          this->fieldOffset,
+                          this->o_fldIn,
+                          &data,
+                          this->o_fldOut);
+      pushLagged(this->postedTimes.front());
+      this->postedTimes.pop_front();
     }
+  }
+  this->balanceWait += MPI_Wtime() - tWait;
+  platform->timer.toc("neknek sync");
+  this->tSync = platform->timer.query("neknek sync", "HOST:MAX");
+
+  platform->timer.tic("neknek exchange", 1);
 
-    auto o_Uold = this->o_U + this->fieldOffset * nrs->NVfields * sizeof(dfloat);
-    auto o_Sold = this->o_S + this->fieldOffset * this->Nscalar * sizeof(dfloat);
-
-    nrs->extrapolateKernel(this->npt,
-                           nrs->NVfields,
-                           this->nEXT,
-                           this->fieldOffset,
-                           this->o_coeffEXT,
-                           o_Uold,
-                           this->o_U);
-
-    if (this->Nscalar) {
-      nrs->extrapolateKernel(this->npt,
-                             this->Nscalar,
-                             this->nEXT,
-                             this->fieldOffset,
-                             this->o_coeffEXT,
-                             o_Sold,
-                             this->o_S);
+  // Lagrange extrapolation from the lagged times to the new time
+  const double time = nrs->timePrevious + nrs->dt[0];
+  std::fill(this->coeffEXT.begin(), this->coeffEXT.end(), 0.0);
+  for (int i = 0; i < this->nLagged; i++) {
+    double w = 1.0;
+    for (int j = 0; j < this->nLagged; j++) {
+      if (j != i)
+        w *= (time - this->lagTimes[j]) / (this->lagTimes[i] - this->lagTimes[j]);
     }
+    this->coeffEXT[i] = w;
   }
+  extrapolateBoundaryState(this, nrs);
 
   platform->timer.toc("neknek exchange");
 
@@ -5,8 +5,10 @@
 #include "nrssys.hpp"
 #include "findpts.hpp"
 #include "pointInterpolation.hpp"
+#include <deque>
 #include <vector>
 #include <memory>
+#include <string>
 
 struct nrs_t;
 
@@ -19,6 +21,12 @@ struct session_data_t {
 
 bool checkCoupled(nrs_t *nrs);
 
+// grid point estimate (nelgt*N^3) of the cost of a session given by its setup file (without .par)
+double neknekSessionWork(const std::string &setupFile);
+
+// split nRanks across sessions proportional to work, at least one rank each
+std::vector<int> neknekRankSplit(const std::vector<double> &work, int nRanks);
+
 class neknek_t {
 public:
   neknek_t(nrs_t *nrs, const session_data_t &session);
@@ -52,8 +60,23 @@ public:
   dfloat tExch;
   dfloat ratio;
 
+  // lagged coupling without a global sync per step
+  bool asyncCoupling;
+  occa::memory o_fldIn;
+  occa::memory o_fldOut;
+  std::deque<double> postedTimes;
+  std::vector<double> lagTimes;
+  int nLagged = 0;
+
+  // measured rank balance across sessions
+  int balanceSteps = 0;
+  double balanceStart = 0;
+  double balanceWait = 0;
+
   std::shared_ptr<pointInterpolation_t> interpolator;
   void updateBoundary(nrs_t *nrs, int tstep, int stage);
+  void updateBoundaryAsync(nrs_t *nrs, int tstep, int stage);
+  void checkRankBalance(int tstep);
 
   occa::kernel copyNekNekPointsKernel;
 };
@@ -110,6 +110,7 @@ struct nrs_t {
 
   occa::memory o_relUrst;
   occa::memory o_Urst;
+  int UrstHead = 0; // ring buffer head, history level k is stored in slot (UrstHead + k) % nEXT
 
   occa::properties *kernelInfo;
 
@@ -2,14 +2,19 @@
    copy velocity data of a given slab (slabIdSrc) to another slab
    (slideIdDst) also known as recycling
 
-   Note: This implementation relies on a special global element
+   Note: The element offset based setup relies on a special global element
          numbering which is only true for extruded meshes in z from nek!
+         The translation based setup works on arbitrary meshes.
  */
 
 #include "nrs.hpp"
 #include "platform.hpp"
 #include "nekInterfaceAdapter.hpp"
 #include "velRecycling.hpp"
+#include "pointInterpolation.hpp"
+#include <algorithm>
+#include <memory>
+#include <vector>
 
 // private members
 namespace {
@@ -35,6 +40,17 @@ static int bID;
 static dfloat wbar;
 
 static int Nblock;
+
+// translation based (sparse) recycling
+static std::unique_ptr<pointInterpolation_t> interp;
+static std::vector<dfloat> xInterp, yInterp, zInterp;
+static dlong Ninlet;
+static dlong inletOffset;
+static occa::memory o_inletIds;
+static occa::memory o_inletU;
+static occa::memory o_inletNormalArea;
+static dfloat inletArea;
+static occa::kernel scatterScaledVectorKernel;
 } // namespace
 
 void velRecycling::buildKernel(occa::properties kernelInfo)
@@ -55,11 +71,36 @@ void velRecycling::buildKernel(occa::properties kernelInfo)
     kernelName = "sumReduction";
     fileName = path + kernelName + extension;
     sumReductionKernel = platform->device.buildKernel(fileName, kernelInfo, true);
+
+    kernelName = "scatterScaledVector";
+    fileName = path + kernelName + extension;
+    scatterScaledVectorKernel = platform->device.buildKernel(fileName, kernelInfo, true);
   }
 }
 
+static void copySparse()
+{
+  // interpolate recycling points, only inlet sized data is moved
+  interp->eval(nrs->NVfields, nrs->fieldOffset, nrs->o_U, inletOffset, o_inletU);
+
+  // rescale, sum_inlet (u.n sWJ) is the only global reduction as the area is fixed
+  const dfloat flux = platform->linAlg->innerProd(nrs->NVfields * inletOffset,
+                                                  o_inletU,
+                                                  o_inletNormalArea,
+                                                  platform->comm.mpiComm);
+  const dfloat scale = -wbar * inletArea / flux;
+
+  if (Ninlet)
+    scatterScaledVectorKernel(Ninlet, inletOffset, nrs->fieldOffset, scale, o_inletIds, o_inletU, o_wrk);
+}
+
 void velRecycling::copy()
 {
+  if (interp) {
+    copySparse();
+    return;
+  }
+
   mesh_t *mesh = nrs->meshV;
 
   const dfloat zero = 0.0;
@@ -156,3 +197,81 @@ void velRecycling::setup(nrs_t *nrs_,
   o_flux = platform->device.malloc(NfpTotal * sizeof(dfloat), flux);
   o_area = platform->device.malloc(NfpTotal * sizeof(dfloat), area);
 }
+
+void velRecycling::setup(nrs_t *nrs_,
+                         occa::memory o_wrk_,
+                         const dfloat xOffset,
+                         const dfloat yOffset,
+                         const dfloat zOffset,
+                         const int bID_,
+                         const dfloat wbar_)
+{
+  nrs = nrs_;
+  o_wrk = o_wrk_;
+  bID = bID_;
+  wbar = wbar_;
+
+  mesh_t *mesh = nrs->meshV;
+
+  // unique local inlet nodes and their area weighted normals
+  std::vector<dlong> inletIndex(mesh->Nlocal, -1);
+  std::vector<dlong> inletIds;
+  std::vector<dfloat> normalArea;
+  dfloat area = 0;
+
+  for (dlong e = 0; e < mesh->Nelements; e++) {
+    for (int f = 0; f < mesh->Nfaces; f++) {
+      if (mesh->EToB[f + e * mesh->Nfaces] != bID)
+        continue;
+
+      for (int m = 0; m < mesh->Nfp; m++) {
+        const dlong sk = e * mesh->Nfp * mesh->Nfaces + f * mesh->Nfp + m;
+        const dlong idM = mesh->vmapM[sk];
+        if (inletIndex[idM] < 0) {
+          inletIndex[idM] = inletIds.size();
+          inletIds.push_back(idM);
+          normalArea.insert(normalArea.end(), {0, 0, 0});
+        }
+
+        const dfloat sWJ = mesh->sgeo[sk * mesh->Nsgeo + WSJID];
+        dfloat *n = normalArea.data() + 3 * inletIndex[idM];
+        n[0] += sWJ * mesh->sgeo[sk * mesh->Nsgeo + NXID];
+        n[1] += sWJ * mesh->sgeo[sk * mesh->Nsgeo + NYID];
+        n[2] += sWJ * mesh->sgeo[sk * mesh->Nsgeo + NZID];
+        area += sWJ;
+      }
+    }
+  }
+  MPI_Allreduce(&area, &inletArea, 1, MPI_DFLOAT, MPI_SUM, platform->comm.mpiComm);
+
+  Ninlet = inletIds.size();
+  inletOffset = std::max(Ninlet, 1); // zero padded
+
+  // syncs host coordinates
+  interp = std::make_unique<pointInterpolation_t>(nrs);
+
+  xInterp.resize(Ninlet);
+  yInterp.resize(Ninlet);
+  zInterp.resize(Ninlet);
+  for (dlong n = 0; n < Ninlet; n++) {
+    xInterp[n] = mesh->x[inletIds[n]] + xOffset;
+    yInterp[n] = mesh->y[inletIds[n]] + yOffset;
+    zInterp[n] = mesh->z[inletIds[n]] + zOffset;
+  }
+
+  interp->setPoints(Ninlet, xInterp.data(), yInterp.data(), zInterp.data());
+  interp->find(pointInterpolation_t::VerbosityLevel::Detailed);
+
+  std::vector<dfloat> normalAreaFld(nrs->NVfields * inletOffset, 0.0);
+  for (dlong n = 0; n < Ninlet; n++)
+    for (int fld = 0; fld < nrs->NVfields; fld++)
+      normalAreaFld[n + fld * inletOffset] = normalArea[3 * n + fld];
+
+  o_inletIds = platform->device.malloc(inletOffset * sizeof(dlong));
+  if (Ninlet)
+    o_inletIds.copyFrom(inletIds.data(), Ninlet * sizeof(dlong));
+  o_inletNormalArea = platform->device.malloc(normalAreaFld.size() * sizeof(dfloat), normalAreaFld.data());
+
+  std::vector<dfloat> zeros(nrs->NVfields * inletOffset, 0.0);
+  o_inletU = platform->device.malloc(zeros.size() * sizeof(dfloat), zeros.data());
+}
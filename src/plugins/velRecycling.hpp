@@ -5,8 +5,9 @@
    copy velocity data of a given slab (slabIdSrc) to another slab
    (slideIdDst) also known as recycling
 
-   Note: This implementation relies on a special global element
+   Note: The element offset based setup relies on a special global element
          numbering which is only true for extruded meshes in z from nek!
+         The translation based setup works on arbitrary meshes.
 */
 
 #include "nrs.hpp"
@@ -18,6 +19,10 @@ void buildKernel(occa::properties kernelInfo);
 void copy();
 void setup(nrs_t* nrs_, occa::memory o_wrk_, const hlong eOffset, const int bID_,
            const dfloat wbar_);
+// inlet node x (boundary bID_) is fed with the velocity interpolated at
+// x + (xOffset, yOffset, zOffset), only inlet values of o_wrk_ are set
+void setup(nrs_t* nrs_, occa::memory o_wrk_, const dfloat xOffset, const dfloat yOffset,
+           const dfloat zOffset, const int bID_, const dfloat wbar_);
 }
 
 #endif
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <cstdio>
 #include <fstream>
 #include <getopt.h>
@@ -115,6 +116,7 @@ static std::vector<std::string> generalKeys = {
     {"subCycling"},
     {"writeControl"},
     {"writeInterval"},
+    {"checkpointEngine"},
     {"constFlowRate"},
     {"verbose"},
     {"variableDT"},
@@ -127,6 +129,8 @@ static std::vector<std::string> generalKeys = {
 
 static std::vector<std::string> neknekKeys = {
     {"boundaryextorder"},
+    {"coupling"},
+    {"balancesteps"},
 };
 
 static std::vector<std::string> problemTypeKeys = {
@@ -141,6 +145,8 @@ static std::vector<std::string> commonKeys = {
     {"initialGuess"},
     {"preconditioner"},
     {"pMGSchedule"},
+    {"pMGAutotune"},
+    {"pMGSchwarzUpdateInterval"},
     {"smootherType"},
     {"coarseSolver"},
     {"semfemSolver"},
@@ -148,6 +154,8 @@ static std::vector<std::string> commonKeys = {
     {"boundaryTypeMap"},
     {"maxIterations"},
     {"regularization"},
+    {"geometricFactors"},
+    {"multigridGeometryPrecision"},
 
     // deprecated filter params
     {"filtering"},
@@ -197,7 +205,7 @@ static std::vector<std::string> boomeramgKeys = {
 static std::vector<std::string> amgxKeys = {
     {"configFile"},
 };
-static std::vector<std::string> occaKeys = {{"backend"}, {"deviceNumber"}, {"platformNumber"}};
+static std::vector<std::string> occaKeys = {{"backend"}, {"deviceNumber"}, {"platformNumber"}, {"kernelTuning"}};
 
 static std::vector<std::string> pressureKeys = {};
 
@@ -605,11 +613,19 @@ void parseCoarseSolver(const int rank, setupAide &options, inipp::Ini *par, std:
       else if (entry.find("overlap") != std::string::npos) {
         std::string currentSettings = options.getArgs(parSectionName + "MGSOLVER CYCLE");
         options.setArgs(parSectionName + "MGSOLVER CYCLE", currentSettings + "+OVERLAPCRS");
-
-        if (!options.compareArgs(parSectionName + "MGSOLVER CYCLE", "ADDITIVE"))
-          append_error("Overlapping coarse solve requires additive multigrid!\n");
       }
     }
+
+    // multiplicative cycle overlaps using an additive coarse grid correction
+    if (options.compareArgs(parSectionName + "MGSOLVER CYCLE", "OVERLAPCRS") &&
+        !options.compareArgs(parSectionName + "MGSOLVER CYCLE", "ADDITIVE")) {
+      if (!boomer)
+        append_error("Overlapping coarse solve of multiplicative multigrid requires boomerAMG!\n");
+      if (options.compareArgs(parSectionName + "MGSOLVER CYCLE", "KCYCLE"))
+        append_error("Overlapping coarse solve is not supported for K-cycle!\n");
+      if (options.compareArgs(parSectionName + "MULTIGRID COARSE SOLVE AND SMOOTH", "TRUE"))
+        append_error("Overlapping coarse solve of multiplicative multigrid does not support +smoother!\n");
+    }
   }
   else {
     options.setArgs(parSectionName + "COARSE SOLVER", "SMOOTHER");
@@ -662,6 +678,17 @@ std::vector<int> checkForIntInInputs(const std::vector<std::string> &inputs)
   return values;
 }
 
+bool checkForTrue(const std::string &s)
+{
+  return (s.find("true") != std::string::npos) || (s.find("yes") != std::string::npos) ||
+         (s.find("1") != std::string::npos);
+}
+bool checkForFalse(const std::string &s)
+{
+  return (s.find("false") != std::string::npos) || (s.find("no ") != std::string::npos) ||
+         (s.find("0") != std::string::npos);
+}
+
 void parseSmoother(const int rank, setupAide &options, inipp::Ini *par, std::string parScope)
 {
   std::string p_smoother;
@@ -808,6 +835,7 @@ void parsePreconditioner(const int rank, setupAide &options, inipp::Ini *par, st
       {"multigrid"},
       {"additive"},
       {"multiplicative"},
+      {"kcycle"},
   };
 
   std::string parSection = parPrefixFromParSection(parScope);
@@ -845,6 +873,11 @@ void parsePreconditioner(const int rank, setupAide &options, inipp::Ini *par, st
     else if (p_preconditioner.find("multiplicative") != std::string::npos) {
       key = "VCYCLE+MULTIPLICATIVE";
     }
+    if (p_preconditioner.find("kcycle") != std::string::npos) {
+      if (p_preconditioner.find("additive") != std::string::npos)
+        append_error("K-cycle requires multiplicative multigrid!\n");
+      key += "+KCYCLE";
+    }
     options.setArgs(parSection + "MGSOLVER CYCLE", key);
   }
   else if (p_preconditioner.find("semfem") != std::string::npos ||
@@ -918,18 +951,34 @@ void parsePreconditioner(const int rank, setupAide &options, inipp::Ini *par, st
           append_error("specified coarse Chebyshev degree, but coarseSolver=smoother is not set.\n");
       }
     }
-  }
-}
 
-bool checkForTrue(const std::string &s)
-{
-  return (s.find("true") != std::string::npos) || (s.find("yes") != std::string::npos) ||
-         (s.find("1") != std::string::npos);
-}
-bool checkForFalse(const std::string &s)
-{
-  return (s.find("false") != std::string::npos) || (s.find("no ") != std::string::npos) ||
-         (s.find("0") != std::string::npos);
+    std::string p_autotune;
+    if (par->extract(parScope, "pmgautotune", p_autotune)) {
+      const std::vector<std::string> validValues = {
+          {"yes"},
+          {"true"},
+          {"1"},
+          {"no"},
+          {"false"},
+          {"0"},
+      };
+      checkValidity(rank, validValues, p_autotune);
+      if (checkForTrue(p_autotune)) {
+        options.setArgs(parSection + "MULTIGRID AUTOTUNE", "TRUE");
+        if (parScope != "pressure")
+          append_error("pMGAutotune is only supported for pressure!\n");
+        if (!options.compareArgs(parSection + "MULTIGRID SMOOTHER", "CHEBYSHEV"))
+          append_error("pMGAutotune requires a Chebyshev smoother!\n");
+      }
+    }
+
+    int p_schwarzUpdateInterval;
+    if (par->extract(parScope, "pmgschwarzupdateinterval", p_schwarzUpdateInterval)) {
+      if (p_schwarzUpdateInterval < 0)
+        append_error("pMGSchwarzUpdateInterval must be >= 0!\n");
+      options.setArgs(parSection + "MULTIGRID SCHWARZ UPDATE INTERVAL", std::to_string(p_schwarzUpdateInterval));
+    }
+  }
 }
 
 void parseLinearSolver(const int rank, setupAide &options, inipp::Ini *par, std::string parScope)
@@ -952,9 +1001,18 @@ void parseLinearSolver(const int rank, setupAide &options, inipp::Ini *par, std:
   if (parScope == "velocity" || parScope == "mesh")
     options.setArgs(parSectionName + "BLOCK SOLVER", "TRUE");
 
+  // K-cycle makes the preconditioner nonlinear
+  auto checkKCycle = [&]() {
+    if (options.compareArgs(parSectionName + "MGSOLVER CYCLE", "KCYCLE") &&
+        !options.compareArgs(parSectionName + "SOLVER", "FLEXIBLE"))
+      append_error("K-cycle requires a flexible solver (pfcg or pfgmres) for " + parScope);
+  };
+
   std::string p_solver;
-  if (!par->extract(parScope, "solver", p_solver))
+  if (!par->extract(parScope, "solver", p_solver)) {
+    checkKCycle();
     return;
+  }
 
   const std::vector<std::string> validValues = {
       {"user"},
@@ -965,6 +1023,8 @@ void parseLinearSolver(const int rank, setupAide &options, inipp::Ini *par, std:
       {"flexible"},
       {"pgmres"},
       {"pcg"},
+      {"pipelined"},
+      {"lowsync"},
       {"block"},
   };
   std::vector<std::string> list = serializeString(p_solver, '+');
@@ -972,6 +1032,11 @@ void parseLinearSolver(const int rank, setupAide &options, inipp::Ini *par, std:
     checkValidity(rank, validValues, s);
   }
 
+  if (p_solver.find("pipelined") != std::string::npos && p_solver.find("cg") == std::string::npos)
+    append_error("pipelined is only supported by CG for " + parScope);
+  if (p_solver.find("lowsync") != std::string::npos && p_solver.find("gmres") == std::string::npos)
+    append_error("lowsync is only supported by GMRES for " + parScope);
+
   if (p_solver.find("gmres") != std::string::npos) {
     std::vector<std::string> list;
     list = serializeString(p_solver, '+');
@@ -983,18 +1048,29 @@ void parseLinearSolver(const int rank, setupAide &options, inipp::Ini *par, std:
       }
     }
     options.setArgs(parSectionName + "PGMRES RESTART", n);
+    const bool lowSync = p_solver.find("lowsync") != std::string::npos;
     if (p_solver.find("fgmres") != std::string::npos || p_solver.find("flexible") != std::string::npos)
       p_solver = "PGMRES+FLEXIBLE";
     else
       p_solver = "PGMRES";
+    if (lowSync)
+      p_solver += "+LOWSYNC";
   }
   else if (p_solver.find("cg") != std::string::npos) {
-    if (p_solver.find("fcg") != std::string::npos || p_solver.find("flexible") != std::string::npos)
+    const std::string p_solverIn = p_solver;
+    const bool flexible = p_solver.find("fcg") != std::string::npos || p_solver.find("flexible") != std::string::npos;
+    if (flexible)
       p_solver = "PCG+FLEXIBLE";
     else
       p_solver = "PCG";
 
-    if (p_solver.find("block") != std::string::npos)
+    if (p_solverIn.find("pipelined") != std::string::npos) {
+      if (flexible)
+        append_error("pipelined CG does not support flexible variant for " + parScope);
+      p_solver += "+PIPELINED";
+    }
+
+    if (p_solverIn.find("block") != std::string::npos)
       options.setArgs(parSectionName + "BLOCK SOLVER", "TRUE");
     else
       options.setArgs(parSectionName + "BLOCK SOLVER", "FALSE");
@@ -1009,6 +1085,7 @@ void parseLinearSolver(const int rank, setupAide &options, inipp::Ini *par, std:
     append_error("Invalid solver for " + parScope);
   }
   options.setArgs(parSectionName + "SOLVER", p_solver);
+  checkKCycle();
 }
 
 void parseInitialGuess(const int rank, setupAide &options, inipp::Ini *par, std::string parScope)
@@ -1084,6 +1161,36 @@ void parseInitialGuess(const int rank, setupAide &options, inipp::Ini *par, std:
     return;
   }
 }
+void parseGeometricFactors(const int rank, setupAide &options, inipp::Ini *par, std::string parScope)
+{
+  std::string parSectionName = parPrefixFromParSection(parScope);
+  upperCase(parSectionName);
+
+  const std::vector<std::string> validValues = {
+      {"stored"},
+      {"recompute"},
+  };
+
+  std::string geom;
+  if (par->extract(parScope, "geometricfactors", geom)) {
+    checkValidity(rank, validValues, geom);
+    if (geom == "recompute")
+      options.setArgs(parSectionName + "ELLIPTIC GEOMETRY", "RECOMPUTE");
+  }
+
+  const std::vector<std::string> validPrecisions = {
+      {"fp64"},
+      {"fp32"},
+  };
+
+  std::string mgGeomPrecision;
+  if (par->extract(parScope, "multigridgeometryprecision", mgGeomPrecision)) {
+    checkValidity(rank, validPrecisions, mgGeomPrecision);
+    if (mgGeomPrecision == "fp32")
+      options.setArgs(parSectionName + "MULTIGRID GEOMETRY PRECISION", "FP32");
+  }
+}
+
 void parseRegularization(const int rank, setupAide &options, inipp::Ini *par, std::string parSection)
 {
   int N;
@@ -1324,6 +1431,7 @@ void setDefaultSettings(setupAide &options, std::string casename, int rank)
   options.setArgs("DEVICE NUMBER", "LOCAL-RANK");
   options.setArgs("PLATFORM NUMBER", "0");
   options.setArgs("VERBOSE", "FALSE");
+  options.setArgs("KERNEL TUNING", "DATABASE");
 
   options.setArgs("ADVECTION", "TRUE");
   options.setArgs("ADVECTION TYPE", "CUBATURE+CONVECTIVE");
@@ -1343,6 +1451,8 @@ void setDefaultSettings(setupAide &options, std::string casename, int rank)
   options.setArgs("VARIABLE DT", "FALSE");
 
   options.setArgs("CHECKPOINT OUTPUT MESH", "FALSE");
+  options.setArgs("CHECKPOINT ENGINE", "NEK");
+  options.setArgs("CHECKPOINT ASYNC", "FALSE");
 
   const auto dropTol = 5.0 * std::numeric_limits<pfloat>::epsilon();
   options.setArgs("AMG DROP TOLERANCE", to_string_f(dropTol));
@@ -1473,6 +1583,13 @@ void parRead(inipp::Ini *par, std::string setupFile, MPI_Comm comm, setupAide &o
     options.setArgs("PLATFORM NUMBER", platformNumber);
   }
 
+  std::string kernelTuning;
+  if (par->extract("occa", "kerneltuning", kernelTuning)) {
+    checkValidity(rank, {"database", "retune", "pinned", "benchmark"}, kernelTuning);
+    upperCase(kernelTuning);
+    options.setArgs("KERNEL TUNING", kernelTuning);
+  }
+
   // GENERAL
   bool verbose = false;
   if (par->extract("general", "verbose", verbose))
@@ -1543,6 +1660,17 @@ void parRead(inipp::Ini *par, std::string setupFile, MPI_Comm comm, setupAide &o
 
   std::string dtString;
   if (par->extract("general", "dt", dtString)) {
+    if (dtString.find("nonblockingcfl") != std::string::npos) {
+      options.setArgs("CFL NONBLOCKING", "TRUE");
+      std::vector<std::string> entries = serializeString(dtString, '+');
+      entries.erase(std::remove(entries.begin(), entries.end(), "nonblockingcfl"), entries.end());
+      dtString.clear();
+      for (const auto &entry : entries)
+        dtString += (dtString.empty() ? "" : "+") + entry;
+      if (dtString.empty())
+        append_error("nonblockingCFL requires a dt or targetCFL");
+    }
+
     const std::vector<std::string> validValues = {
         {"targetcfl"},
         {"max"},
@@ -1628,7 +1756,7 @@ void parRead(inipp::Ini *par, std::string setupFile, MPI_Comm comm, setupAide &o
         }
       }
     }
-    else {
+    else if (!dtString.empty()) {
       const double dt = std::stod(dtString);
       options.setArgs("DT", to_string_f(fabs(dt)));
     }
@@ -1715,6 +1843,29 @@ void parRead(inipp::Ini *par, std::string setupFile, MPI_Comm comm, setupAide &o
     }
   }
 
+  std::string checkpointEngine;
+  if (par->extract("general", "checkpointengine", checkpointEngine)) {
+    const std::vector<std::string> list = serializeString(checkpointEngine, '+');
+
+    checkValidity(rank, {"nek", "nekrs"}, list[0]);
+    if (list[0] == "nekrs")
+      options.setArgs("CHECKPOINT ENGINE", "NEKRS");
+    else if (list[0] == "nek")
+      options.setArgs("CHECKPOINT ENGINE", "NEK");
+
+    for (int i = 1; i < list.size(); i++) {
+      checkValidity(rank, {"async"}, list[i]);
+      if (list[i] == "async")
+        options.setArgs("CHECKPOINT ASYNC", "TRUE");
+    }
+
+    if (options.compareArgs("CHECKPOINT ASYNC", "TRUE") && !options.compareArgs("CHECKPOINT ENGINE", "NEKRS")) {
+      std::ostringstream error;
+      error << "general::checkpointEngine = " << checkpointEngine << " (async requires nekRS engine)";
+      append_error(error.str());
+    }
+  }
+
   bool dealiasing = true;
   if (par->extract("general", "dealiasing", dealiasing)) {
     if (dealiasing)
@@ -1739,6 +1890,24 @@ void parRead(inipp::Ini *par, std::string setupFile, MPI_Comm comm, setupAide &o
     options.setArgs("NEKNEK BOUNDARY EXT ORDER", std::to_string(boundaryEXTOrder));
   }
 
+  std::string neknekCoupling;
+  if (par->extract("neknek", "coupling", neknekCoupling)) {
+    const std::vector<std::string> validValues = {
+        {"sync"},
+        {"async"},
+    };
+    checkValidity(rank, validValues, neknekCoupling);
+    upperCase(neknekCoupling);
+    options.setArgs("NEKNEK COUPLING", neknekCoupling);
+  }
+
+  int neknekBalanceSteps;
+  if (par->extract("neknek", "balancesteps", neknekBalanceSteps)) {
+    if (neknekBalanceSteps < 0)
+      append_error("balanceSteps must be non-negative");
+    options.setArgs("NEKNEK BALANCE STEPS", std::to_string(neknekBalanceSteps));
+  }
+
   // PROBLEMTYPE
   bool stressFormulation;
   if (par->extract("problemtype", "stressformulation", stressFormulation)) {
@@ -1855,6 +2024,8 @@ void parRead(inipp::Ini *par, std::string setupFile, MPI_Comm comm, setupAide &o
 
     parseSolverTolerance(rank, options, par, "pressure");
 
+    parseGeometricFactors(rank, options, par, "pressure");
+
     parseInitialGuess(rank, options, par, "pressure");
 
     parsePreconditioner(rank, options, par, "pressure");
@@ -1916,6 +2087,8 @@ void parRead(inipp::Ini *par, std::string setupFile, MPI_Comm comm, setupAide &o
 
     parseSolverTolerance(rank, options, par, "velocity");
 
+    parseGeometricFactors(rank, options, par, "velocity");
+
     std::string v_bcMap;
     if (par->extract("velocity", "boundarytypemap", v_bcMap)) {
       std::vector<std::string> sList;
@@ -1979,6 +2152,8 @@ void parRead(inipp::Ini *par, std::string setupFile, MPI_Comm comm, setupAide &o
 
       parseSolverTolerance(rank, options, par, "temperature");
 
+      parseGeometricFactors(rank, options, par, "temperature");
+
       if (par->extract("temperature", "conductivity", sbuf)) {
         int err = 0;
         double diffusivity = te_interp(sbuf.c_str(), &err);
@@ -2081,6 +2256,8 @@ void parRead(inipp::Ini *par, std::string setupFile, MPI_Comm comm, setupAide &o
 
     parseSolverTolerance(rank, options, par, parScope);
 
+    parseGeometricFactors(rank, options, par, parScope);
+
     if (par->extract(parScope, "diffusivity", sbuf)) {
       int err = 0;
       double diffusivity = te_interp(sbuf.c_str(), &err);
@@ -7,6 +7,7 @@
 #include "bdry.hpp"
 #include "bcMap.hpp"
 #include "nekInterfaceAdapter.hpp"
+#include "fldWriter.hpp"
 #include "udf.hpp"
 #include "filter.hpp"
 #include "avm.hpp"
@@ -90,6 +91,70 @@ void printICMinMax(nrs_t *nrs)
   }
 }
 
+elliptic_t *scalarBlockSolverSetup(nrs_t *nrs, const occa::memory &o_wrk)
+{
+  cds_t *cds = nrs->cds;
+  mesh_t *mesh = cds->meshV;
+  const int Nfields = cds->blockNfields;
+  const std::string sidFirst = scalarDigitStr(cds->blockFirst);
+  const std::string sidLast = scalarDigitStr(cds->blockFirst + Nfields - 1);
+
+  if (platform->comm.mpiRank == 0)
+    std::cout << "============ ELLIPTIC SETUP SCALAR" << sidFirst << "-" << sidLast << " (BLOCK) ============\n";
+
+  // lambda0 of all fields followed by lambda1 of all fields
+  cds->o_blockEllipticCoeff = platform->device.malloc((2 * Nfields * sizeof(dfloat)) * nrs->fieldOffset);
+
+  auto solver = new elliptic_t();
+  solver->name = "scalar" + sidFirst;
+  solver->blockSolver = 1;
+  solver->stressForm = 0;
+  solver->Nfields = Nfields;
+  solver->fieldOffset = nrs->fieldOffset;
+  solver->loffset = nrs->fieldOffset;
+  solver->o_wrk = o_wrk;
+  solver->mesh = mesh;
+  solver->elementType = cds->elementType;
+  solver->poisson = 0;
+
+  solver->EToB = (int *)calloc(mesh->Nelements * mesh->Nfaces * Nfields, sizeof(int));
+  for (int fld = 0; fld < Nfields; fld++) {
+    const int is = cds->blockFirst + fld;
+    const std::string sid = scalarDigitStr(is);
+
+    cds->setEllipticCoeffKernel(mesh->Nlocal,
+                                cds->g0 * cds->idt,
+                                cds->fieldOffsetScan[is],
+                                Nfields * nrs->fieldOffset,
+                                0,
+                                cds->o_diff,
+                                cds->o_rho,
+                                o_NULL,
+                                cds->o_blockEllipticCoeff + (fld * sizeof(dfloat)) * nrs->fieldOffset);
+
+    for (int bID = 1; bID <= bcMap::size(0); bID++) {
+      std::string bcTypeText(bcMap::text(bID, "scalar" + sid));
+      if (platform->comm.mpiRank == 0 && bcTypeText.size())
+        printf("scalar%s: bID %d -> bcType %s\n", sid.c_str(), bID, bcTypeText.c_str());
+    }
+
+    for (dlong e = 0; e < mesh->Nelements; e++) {
+      for (int f = 0; f < mesh->Nfaces; f++) {
+        const int offset = fld * mesh->Nelements * mesh->Nfaces;
+        const int bID = mesh->EToB[f + e * mesh->Nfaces];
+        solver->EToB[f + e * mesh->Nfaces + offset] = bcMap::ellipticType(bID, "scalar" + sid);
+      }
+    }
+  }
+
+  solver->o_lambda0 = cds->o_blockEllipticCoeff.slice(0);
+  solver->o_lambda1 = cds->o_blockEllipticCoeff.slice((Nfields * sizeof(dfloat)) * nrs->fieldOffset);
+
+  ellipticSolveSetup(solver);
+
+  return solver;
+}
+
 void nrsSetup(MPI_Comm comm, setupAide &options, nrs_t *nrs)
 {
   platform_t *platform = platform_t::getInstance();
@@ -141,6 +206,7 @@ void nrsSetup(MPI_Comm comm, setupAide &options, nrs_t *nrs)
     platform->options.getArgs("CASENAME", casename);
 
     nek::setup(nrs);
+    fld::setup(nrs);
     nek::setic();
     nek::userchk();
     if (platform->comm.mpiRank == 0)
@@ -244,10 +310,15 @@ void nrsSetup(MPI_Comm comm, setupAide &options, nrs_t *nrs)
   }
 
   // setup mempool
+  int scalarBlockFirst, scalarBlockNfields;
+  cdsBlockScalars(scalarBlockFirst, scalarBlockNfields);
+
   int ellipticMaxFields = 1;
   if (platform->options.compareArgs("VELOCITY BLOCK SOLVER", "TRUE"))
     ellipticMaxFields = nrs->NVfields;
+  ellipticMaxFields = std::max(ellipticMaxFields, scalarBlockNfields);
   const int ellipticWrkFields = elliptic_t::NScratchFields * ellipticMaxFields;
+  const int ellipticIOFields = std::max(nrs->NVfields, scalarBlockNfields);
 
   int wrkFields = 10;
   if (nrs->Nsubsteps)
@@ -255,12 +326,12 @@ void nrsSetup(MPI_Comm comm, setupAide &options, nrs_t *nrs)
   if (options.compareArgs("MOVING MESH", "TRUE"))
     wrkFields += nrs->NVfields;
 
-  const int mempoolNflds = std::max(wrkFields, 2 * nrs->NVfields + ellipticWrkFields);
+  const int mempoolNflds = std::max(wrkFields, 2 * ellipticIOFields + ellipticWrkFields);
   platform->create_mempool(nrs->fieldOffset, mempoolNflds);
 
   // offset mempool available for elliptic because also used it for ellipticSolve input/output
   auto const o_mempoolElliptic =
-      platform->o_mempool.o_ptr.slice((2 * nrs->NVfields * sizeof(dfloat)) * nrs->fieldOffset);
+      platform->o_mempool.o_ptr.slice((2 * ellipticIOFields * sizeof(dfloat)) * nrs->fieldOffset);
 
   if (options.compareArgs("MOVING MESH", "TRUE")) {
     const int nBDF = std::max(nrs->nBDF, nrs->nEXT);
@@ -573,6 +644,9 @@ void nrsSetup(MPI_Comm comm, setupAide &options, nrs_t *nrs)
   if (nrs->Nscalar) {
     cds_t *cds = nrs->cds;
 
+    cds->blockFirst = scalarBlockFirst;
+    cds->blockNfields = scalarBlockNfields;
+
     for (int is = 0; is < cds->NSfields; is++) {
       std::string sid = scalarDigitStr(is);
 
@@ -582,6 +656,13 @@ void nrsSetup(MPI_Comm comm, setupAide &options, nrs_t *nrs)
       mesh_t *mesh;
       (is) ? mesh = cds->meshV : mesh = cds->mesh[0]; // only first scalar can be a CHT mesh
 
+      if (cds->blockNfields && is >= cds->blockFirst && is < cds->blockFirst + cds->blockNfields) {
+        if (is == cds->blockFirst)
+          cds->blockSolver = scalarBlockSolverSetup(nrs, o_mempoolElliptic);
+        cds->solver[is] = cds->blockSolver;
+        continue;
+      }
+
       if (platform->comm.mpiRank == 0)
         std::cout << "================= ELLIPTIC SETUP SCALAR" << sid << " ===============\n";
 